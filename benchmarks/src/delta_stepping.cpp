@@ -0,0 +1,60 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "Simple-Graph/delta_stepping.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+#include <string>
+#include <thread>
+
+using namespace sl::graph;
+
+TEST_CASE("delta_stepping scaling compared to dijkstra.", "[benchmark][delta_stepping]")
+{
+	constexpr int vertexCount{ 200'000 };
+	const adjacency_graph graph{ make_random_graph(vertexCount, 8, 100, 42) };
+
+	BENCHMARK("dijkstra")
+	{
+		std::size_t visited{};
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+				.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+				.callback = [&](const auto&) { ++visited; },
+				.stateMap = dense_state_map<dijkstra::state_t<int>>{ std::vector<dijkstra::state_t<int>>(vertexCount) }
+			}
+		);
+		return visited;
+	};
+
+	const std::size_t maxThreads{ std::max(std::thread::hardware_concurrency(), 1u) };
+	for (std::size_t threadCount{ 1 }; threadCount <= maxThreads; threadCount *= 2)
+	{
+		BENCHMARK("delta_stepping threads: " + std::to_string(threadCount))
+		{
+			return shortest_paths
+			(
+				delta_stepping::search_params
+				{
+					.begin = 0,
+					.vertexCount = vertexCount,
+					.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+					.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+					.delta = 25,
+					.threadCount = threadCount
+				}
+			);
+		};
+	}
+}
@@ -0,0 +1,27 @@
+//          Copyright Dominic Koepke 2022 - 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_BENCHMARKS_HELPER_HPP
+#define SIMPLE_GRAPH_BENCHMARKS_HELPER_HPP
+
+#pragma once
+
+#include "adjacency_graph.hpp"
+
+#include <vector>
+
+// state map for dense vertex ids, which avoids the std::map overhead in the baseline measurements
+template <class TState>
+struct dense_state_map
+{
+	std::vector<TState> states{};
+
+	TState& operator [](const int& v)
+	{
+		return states[v];
+	}
+};
+
+#endif
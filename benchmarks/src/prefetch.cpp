@@ -0,0 +1,68 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "Simple-Graph/csr_graph.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace sl::graph;
+
+TEST_CASE("dijkstra with prefetched expansion compared to direct expansion.", "[benchmark][dijkstra][prefetch]")
+{
+	// each state takes 8 bytes, thus the state map of 100k vertices (about 800 KB) still fits into the last level cache and
+	// serves as baseline, while the one of 2M vertices (about 16 MB) exceeds it on most machines
+	for (const int vertexCount : { 100'000, 2'000'000 })
+	{
+		const adjacency_graph graph{ make_random_graph(vertexCount, 8, 100, 42) };
+		const auto csrGraph = make_csr_graph<int>
+		(
+			vertexCount,
+			adjacency_graph_neighbor_searcher{ &graph },
+			adjacency_graph_weight_extractor{ &graph }
+		);
+
+		for (const expansion_mode mode : { expansion_mode::direct, expansion_mode::prefetched })
+		{
+			const std::string modeName{ mode == expansion_mode::direct ? "direct" : "prefetched" };
+
+			BENCHMARK_ADVANCED("dijkstra " + modeName + " vertices: " + std::to_string(vertexCount))(Catch::Benchmark::Chronometer meter)
+			{
+				// the state maps are prepared in beforehand, thus their allocation and initialization is not measured
+				std::vector<std::vector<dijkstra::state_t<int>>> stateMaps(
+					static_cast<std::size_t>(meter.runs()),
+					std::vector<dijkstra::state_t<int>>(vertexCount)
+				);
+
+				meter.measure
+				(
+					[&](const int run)
+					{
+						std::size_t visited{};
+						traverse
+						(
+							dijkstra::search_params
+							{
+								.begin = 0,
+								.neighborSearcher = csr_neighbor_searcher{ &csrGraph },
+								.weightCalculator = csr_weight_calculator{ &csrGraph },
+								.callback = [&](const auto&) { ++visited; },
+								.stateMap = std::move(stateMaps[static_cast<std::size_t>(run)]),
+								.expansionMode = mode
+							}
+						);
+						return visited;
+					}
+				);
+			};
+		}
+	}
+}
@@ -0,0 +1,610 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_ALT_HPP
+#define SIMPLE_GRAPH_ALT_HPP
+
+#pragma once
+
+#include "csr_graph.hpp"
+#include "dijkstra.hpp"
+#include "parallel_helper.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace sl::graph::alt
+{
+	/** \addtogroup alt
+	* @{
+	* \brief Provides landmark based heuristics (ALT: A*, landmarks and triangle inequality) for the astar algorithm.
+	* \details For each landmark L the distances from L to each vertex, and from each vertex to L, are precomputed. Due to the
+	* triangle inequality, ``d(L, t) - d(L, v)`` and ``d(v, L) - d(t, L)`` are lower bounds of the distance ``d(v, t)``, which
+	* results in an admissible and consistent heuristic for arbitrary graphs.
+	* ALT operates on graphs with dense vertex ids, thus each vertex must be an integral value in the range ``[0, vertexCount)``.
+	*/
+
+	/**
+	 * \brief The available landmark selection strategies.
+	 */
+	enum class selection_strategy
+	{
+		/**
+		 * \brief Each landmark is the vertex, which is farthest away from all previously selected landmarks.
+		 */
+		farthest,
+
+		/**
+		 * \brief Each landmark is placed into the region of a shortest path tree, which is covered worst by the previously
+		 * selected landmarks.
+		 */
+		avoid
+	};
+
+	/**
+	 * \brief The precomputed landmark distances.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \details The distances are stored vertex-major, thus all distances of a single vertex are adjacent in memory.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	class landmark_table_t
+	{
+	public:
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Denotes unreachable vertices.
+		 */
+		static constexpr TWeight infinity{ std::numeric_limits<TWeight>::max() };
+
+		/**
+		 * \brief Constructor.
+		 * \param landmarks The landmarks.
+		 * \param vertexCount The total amount of vertices.
+		 * \param fromLandmarks The distances from each landmark to each vertex, stored at ``v * landmarkCount + landmarkIndex``.
+		 * \param toLandmarks The distances from each vertex to each landmark, stored at ``v * landmarkCount + landmarkIndex``.
+		 */
+		landmark_table_t
+		(
+			std::vector<TVertex> landmarks,
+			std::size_t vertexCount,
+			std::vector<TWeight> fromLandmarks,
+			std::vector<TWeight> toLandmarks
+		) noexcept
+			: m_Landmarks{ std::move(landmarks) },
+			m_VertexCount{ vertexCount },
+			m_FromLandmarks{ std::move(fromLandmarks) },
+			m_ToLandmarks{ std::move(toLandmarks) }
+		{
+			assert(std::size(m_FromLandmarks) == std::size(m_Landmarks) * m_VertexCount);
+			assert(std::size(m_ToLandmarks) == std::size(m_Landmarks) * m_VertexCount);
+		}
+
+		/**
+		 * \brief Returns all landmarks.
+		 */
+		[[nodiscard]]
+		std::span<const TVertex> landmarks() const noexcept
+		{
+			return m_Landmarks;
+		}
+
+		/**
+		 * \brief Returns the amount of vertices.
+		 */
+		[[nodiscard]]
+		std::size_t vertex_count() const noexcept
+		{
+			return m_VertexCount;
+		}
+
+		/**
+		 * \brief Returns the distance from the landmark to the vertex, or ``infinity`` if unreachable.
+		 */
+		[[nodiscard]]
+		const TWeight& distance_from_landmark(std::size_t landmarkIndex, const TVertex& v) const noexcept
+		{
+			return m_FromLandmarks[position(landmarkIndex, v)];
+		}
+
+		/**
+		 * \brief Returns the distance from the vertex to the landmark, or ``infinity`` if unreachable.
+		 */
+		[[nodiscard]]
+		const TWeight& distance_to_landmark(std::size_t landmarkIndex, const TVertex& v) const noexcept
+		{
+			return m_ToLandmarks[position(landmarkIndex, v)];
+		}
+
+		/**
+		 * \brief Computes the lower bound of the distance between both vertices, which is provided by the given landmark.
+		 */
+		[[nodiscard]]
+		TWeight lower_bound(std::size_t landmarkIndex, const TVertex& v, const TVertex& destination) const noexcept
+		{
+			return lower_bound_at(position(landmarkIndex, v), position(landmarkIndex, destination));
+		}
+
+		/**
+		 * \brief Computes the lower bound of the distance between both vertices, which is provided by the given landmarks.
+		 */
+		[[nodiscard]]
+		TWeight lower_bound(std::span<const std::size_t> landmarkIndices, const TVertex& v, const TVertex& destination) const noexcept
+		{
+			assert(static_cast<std::size_t>(v) < m_VertexCount && "vertex is out of range.");
+			assert(static_cast<std::size_t>(destination) < m_VertexCount && "destination is out of range.");
+			const std::size_t vOffset{ static_cast<std::size_t>(v) * std::size(m_Landmarks) };
+			const std::size_t destinationOffset{ static_cast<std::size_t>(destination) * std::size(m_Landmarks) };
+
+			TWeight result{};
+			for (const std::size_t i : landmarkIndices)
+			{
+				result = std::max(result, lower_bound_at(vOffset + i, destinationOffset + i));
+			}
+			return result;
+		}
+
+	private:
+		std::vector<TVertex> m_Landmarks;
+		std::size_t m_VertexCount;
+		std::vector<TWeight> m_FromLandmarks;
+		std::vector<TWeight> m_ToLandmarks;
+
+		[[nodiscard]]
+		std::size_t position(std::size_t landmarkIndex, const TVertex& v) const noexcept
+		{
+			assert(landmarkIndex < std::size(m_Landmarks));
+			assert(static_cast<std::size_t>(v) < m_VertexCount && "vertex is out of range.");
+			return static_cast<std::size_t>(v) * std::size(m_Landmarks) + landmarkIndex;
+		}
+
+		// unreachable vertices don't provide any bound
+		[[nodiscard]]
+		TWeight lower_bound_at(std::size_t vPos, std::size_t destinationPos) const noexcept
+		{
+			TWeight result{};
+			if (const TWeight& fromV = m_FromLandmarks[vPos], &fromDestination = m_FromLandmarks[destinationPos];
+				fromV != infinity && fromDestination != infinity && fromV < fromDestination)
+			{
+				result = fromDestination - fromV;
+			}
+			if (const TWeight& toV = m_ToLandmarks[vPos], &toDestination = m_ToLandmarks[destinationPos];
+				toV != infinity && toDestination != infinity && toDestination < toV)
+			{
+				result = std::max<TWeight>(result, toV - toDestination);
+			}
+			return result;
+		}
+	};
+
+	/**
+	 * \brief Heuristic type, which may be directly used as ``astar::search_params::heuristic``.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	class heuristic_t
+	{
+	public:
+		/**
+		 * \brief Alias for the table type.
+		 */
+		using table_t = landmark_table_t<TVertex, TWeight>;
+
+		/**
+		 * \brief Constructor.
+		 * \param table The landmark table. Must outlive this object.
+		 * \param destination The destination vertex.
+		 * \param activeLandmarks The indices of all landmarks, which shall be considered.
+		 */
+		heuristic_t(const table_t& table, const TVertex& destination, std::vector<std::size_t> activeLandmarks) noexcept
+			: m_Table{ &table },
+			m_Destination{ destination },
+			m_ActiveLandmarks{ std::move(activeLandmarks) }
+		{
+		}
+
+		/**
+		 * \brief Returns the estimated distance between the vertex and the destination.
+		 */
+		[[nodiscard]]
+		TWeight operator ()(const TVertex& v) const noexcept
+		{
+			return m_Table->lower_bound(m_ActiveLandmarks, v, m_Destination);
+		}
+
+		/**
+		 * \brief Returns the indices of the active landmarks.
+		 */
+		[[nodiscard]]
+		std::span<const std::size_t> active_landmarks() const noexcept
+		{
+			return m_ActiveLandmarks;
+		}
+
+	private:
+		const table_t* m_Table;
+		TVertex m_Destination;
+		std::vector<std::size_t> m_ActiveLandmarks;
+	};
+
+	/**
+	 * \brief Creates a heuristic for the given query, which considers the landmarks with the best bounds between begin and
+	 * destination.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \param table The landmark table. Must outlive the heuristic.
+	 * \param begin The begin vertex of the query.
+	 * \param destination The destination vertex of the query.
+	 * \param activeLandmarkCount The amount of landmarks considered by the heuristic. Fewer landmarks reduce the costs of each
+	 * estimation, but may result in less accurate estimations.
+	 * \return Returns the newly created heuristic.
+	 */
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	heuristic_t<TVertex, TWeight> make_heuristic
+	(
+		const landmark_table_t<TVertex, TWeight>& table,
+		const std::type_identity_t<TVertex>& begin,
+		const std::type_identity_t<TVertex>& destination,
+		std::size_t activeLandmarkCount = 4
+	)
+	{
+		std::vector<std::size_t> indices(std::size(table.landmarks()));
+		for (std::size_t i{ 0 }; i < std::size(indices); ++i)
+		{
+			indices[i] = i;
+		}
+
+		activeLandmarkCount = std::min(activeLandmarkCount, std::size(indices));
+		std::ranges::partial_sort
+		(
+			indices,
+			std::begin(indices) + static_cast<std::ptrdiff_t>(activeLandmarkCount),
+			std::ranges::greater{},
+			[&](const std::size_t i) { return table.lower_bound(i, begin, destination); }
+		);
+		indices.resize(activeLandmarkCount);
+		return { table, destination, std::move(indices) };
+	}
+
+	/**
+	 * \brief The params of the landmark precomputation.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+		requires std::is_arithmetic_v<TWeight>
+	struct build_params
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the result type.
+		 */
+		using table_t = landmark_table_t<TVertex, TWeight>;
+
+		/**
+		 * \brief The graph. Use ``make_csr_graph`` for creating it from a neighbor searcher and weight calculator.
+		 * \attention All weights must be greater or equal to zero.
+		 */
+		csr_graph<TVertex, TWeight> graph{};
+
+		/**
+		 * \brief The amount of landmarks to be selected.
+		 */
+		std::size_t landmarkCount{ 16 };
+
+		/**
+		 * \brief The landmark selection strategy.
+		 */
+		selection_strategy strategy{ selection_strategy::avoid };
+
+		/**
+		 * \brief The seed for the random root selection.
+		 */
+		std::uint32_t seed{};
+
+		/**
+		 * \brief The amount of threads to be used. If set to 0, ``std::thread::hardware_concurrency`` is used.
+		 */
+		std::size_t threadCount{ 1 };
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TVertex, class TWeight>
+	struct alt_dijkstra_result_t
+	{
+		std::vector<TWeight> distances{};
+		std::vector<TVertex> predecessors{};
+		std::vector<TVertex> settleOrder{};
+	};
+
+	// runs the existing dijkstra and stores the distances into a dense vector
+	template <class TVertex, class TWeight>
+	void alt_dijkstra
+	(
+		const csr_graph<TVertex, TWeight>& graph,
+		const TVertex& begin,
+		alt_dijkstra_result_t<TVertex, TWeight>& result
+	)
+	{
+		const std::size_t vertexCount{ graph.vertex_count() };
+		result.distances.assign(vertexCount, std::numeric_limits<TWeight>::max());
+		result.predecessors.assign(vertexCount, begin);
+		result.settleOrder.clear();
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = csr_neighbor_searcher{ &graph },
+				.weightCalculator = csr_weight_calculator{ &graph },
+				.callback = [&](const auto& node)
+				{
+					result.distances[static_cast<std::size_t>(node.vertex)] = node.weight_sum;
+					result.predecessors[static_cast<std::size_t>(node.vertex)] = node.predecessor.value_or(begin);
+					result.settleOrder.emplace_back(node.vertex);
+				},
+				.stateMap = std::vector<dijkstra::state_t<TWeight>>(vertexCount)
+			}
+		);
+	}
+
+	template <class TVertex, class TWeight>
+	class alt_landmark_selector
+	{
+	public:
+		using result_t = alt_dijkstra_result_t<TVertex, TWeight>;
+
+		static constexpr TWeight infinity{ std::numeric_limits<TWeight>::max() };
+
+		alt_landmark_selector(const csr_graph<TVertex, TWeight>& graph, std::uint32_t seed)
+			: m_Graph{ &graph },
+			m_Random{ seed }
+		{
+		}
+
+		// selects the landmarks; the distances from each landmark are a byproduct of the selection
+		void run(std::size_t landmarkCount, alt::selection_strategy strategy)
+		{
+			const std::size_t vertexCount{ m_Graph->vertex_count() };
+			landmarkCount = std::min(landmarkCount, vertexCount);
+			m_MinDistances.assign(vertexCount, infinity);
+			while (std::size(m_Landmarks) < landmarkCount)
+			{
+				const std::optional<TVertex> landmark = strategy == alt::selection_strategy::avoid
+															? select_avoid()
+															: select_farthest();
+				if (!landmark)
+					break;
+
+				m_Landmarks.emplace_back(*landmark);
+				alt_dijkstra(*m_Graph, *landmark, m_Search);
+				for (std::size_t i{ 0 }; i < vertexCount; ++i)
+				{
+					m_MinDistances[i] = std::min(m_MinDistances[i], m_Search.distances[i]);
+				}
+				m_FromLandmarks.emplace_back(m_Search.distances);
+			}
+		}
+
+		[[nodiscard]]
+		std::vector<TVertex>& landmarks() noexcept
+		{
+			return m_Landmarks;
+		}
+
+		[[nodiscard]]
+		std::vector<std::vector<TWeight>>& from_landmarks() noexcept
+		{
+			return m_FromLandmarks;
+		}
+
+	private:
+		const csr_graph<TVertex, TWeight>* m_Graph;
+		std::mt19937 m_Random;
+		std::vector<TVertex> m_Landmarks{};
+		std::vector<std::vector<TWeight>> m_FromLandmarks{};
+		std::vector<TWeight> m_MinDistances{};
+		result_t m_Search{};
+
+		[[nodiscard]]
+		bool is_landmark(const TVertex& v) const noexcept
+		{
+			return std::ranges::find(m_Landmarks, v) != std::end(m_Landmarks);
+		}
+
+		[[nodiscard]]
+		TVertex random_vertex()
+		{
+			std::uniform_int_distribution<std::size_t> dist{ 0, m_Graph->vertex_count() - 1 };
+			return static_cast<TVertex>(dist(m_Random));
+		}
+
+		// prefers vertices, which aren't reachable by any landmark
+		[[nodiscard]]
+		std::optional<TVertex> select_farthest()
+		{
+			if (std::empty(m_Landmarks))
+			{
+				alt_dijkstra(*m_Graph, random_vertex(), m_Search);
+				return m_Search.settleOrder.back();
+			}
+
+			std::optional<TVertex> result{};
+			for (std::size_t i{ 0 }; i < std::size(m_MinDistances); ++i)
+			{
+				const auto v{ static_cast<TVertex>(i) };
+				if (!is_landmark(v) && (!result || m_MinDistances[static_cast<std::size_t>(*result)] < m_MinDistances[i]))
+				{
+					result = v;
+				}
+			}
+			return result;
+		}
+
+		// lower bound of the distance between root and v, provided by the already selected landmarks
+		[[nodiscard]]
+		TWeight lower_bound(const TVertex& root, const TVertex& v) const noexcept
+		{
+			TWeight result{};
+			for (const std::vector<TWeight>& distances : m_FromLandmarks)
+			{
+				const TWeight& toRoot = distances[static_cast<std::size_t>(root)];
+				const TWeight& toV = distances[static_cast<std::size_t>(v)];
+				if (toRoot != infinity && toV != infinity && toRoot < toV)
+				{
+					result = std::max<TWeight>(result, toV - toRoot);
+				}
+			}
+			return result;
+		}
+
+		// descends the shortest path tree of a random root into the subtree, which is covered worst by the current landmarks.
+		// Subtrees containing a landmark have a size of zero and are thus never entered (see Goldberg and Harrelson).
+		[[nodiscard]]
+		std::optional<TVertex> select_avoid()
+		{
+			const std::size_t vertexCount{ m_Graph->vertex_count() };
+			const TVertex root{ random_vertex() };
+			alt_dijkstra(*m_Graph, root, m_Search);
+
+			std::vector<TWeight> sizes(vertexCount);
+			std::vector<char> isCovered(vertexCount);
+			for (const TVertex& v : m_Search.settleOrder | std::views::reverse)
+			{
+				const auto index{ static_cast<std::size_t>(v) };
+				if (isCovered[index] || is_landmark(v))
+				{
+					isCovered[index] = true;
+					sizes[index] = TWeight{};
+				}
+				else
+				{
+					sizes[index] += m_Search.distances[index] - lower_bound(root, v);
+				}
+
+				if (v != root)
+				{
+					const auto predecessor{ static_cast<std::size_t>(m_Search.predecessors[index]) };
+					isCovered[predecessor] = isCovered[predecessor] || isCovered[index];
+					sizes[predecessor] += sizes[index];
+				}
+			}
+
+			std::vector<std::vector<TVertex>> children(vertexCount);
+			for (const TVertex& v : m_Search.settleOrder)
+			{
+				if (v != root)
+				{
+					children[static_cast<std::size_t>(m_Search.predecessors[static_cast<std::size_t>(v)])].emplace_back(v);
+				}
+			}
+
+			TVertex current{ root };
+			for (;;)
+			{
+				const std::vector<TVertex>& curChildren = children[static_cast<std::size_t>(current)];
+				const auto itr = std::ranges::max_element
+				(
+					curChildren,
+					std::ranges::less{},
+					[&](const TVertex& v) { return sizes[static_cast<std::size_t>(v)]; }
+				);
+				if (itr == std::end(curChildren) || !(TWeight{} < sizes[static_cast<std::size_t>(*itr)]))
+					break;
+				current = *itr;
+			}
+
+			// the root may be covered itself, but the descent only stops at the root, if none of its subtrees has a positive size
+			if (!(TWeight{} < sizes[static_cast<std::size_t>(current)]))
+				return select_farthest();
+			return current;
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Selects the landmarks and precomputes their distance tables.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \param params The build_params object.
+	 * \return Returns the landmark table.
+	 * \details The landmarks are selected one after another, but the distance tables towards the landmarks are computed in
+	 * parallel afterwards.
+	 * \ingroup alt
+	 */
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	alt::landmark_table_t<TVertex, TWeight> build_landmarks(const alt::build_params<TVertex, TWeight>& params)
+	{
+		const std::size_t vertexCount{ params.graph.vertex_count() };
+
+		detail::alt_landmark_selector<TVertex, TWeight> selector{ params.graph, params.seed };
+		selector.run(params.landmarkCount, params.strategy);
+		std::vector<TVertex>& landmarks = selector.landmarks();
+		const std::size_t landmarkCount{ std::size(landmarks) };
+
+		const csr_graph<TVertex, TWeight> transposed{ transpose(params.graph) };
+		const std::size_t threadCount{ detail::resolve_thread_count(params.threadCount) };
+		std::vector<detail::alt_dijkstra_result_t<TVertex, TWeight>> searches(threadCount);
+		std::vector<TWeight> fromLandmarks(landmarkCount * vertexCount);
+		std::vector<TWeight> toLandmarks(landmarkCount * vertexCount);
+		detail::parallel_for
+		(
+			threadCount,
+			landmarkCount,
+			[&](const std::size_t threadIndex, const std::size_t landmarkIndex)
+			{
+				detail::alt_dijkstra(transposed, landmarks[landmarkIndex], searches[threadIndex]);
+				const std::vector<TWeight>& from = selector.from_landmarks()[landmarkIndex];
+				const std::vector<TWeight>& to = searches[threadIndex].distances;
+				for (std::size_t v{ 0 }; v < vertexCount; ++v)
+				{
+					fromLandmarks[v * landmarkCount + landmarkIndex] = from[v];
+					toLandmarks[v * landmarkCount + landmarkIndex] = to[v];
+				}
+			}
+		);
+
+		return { std::move(landmarks), vertexCount, std::move(fromLandmarks), std::move(toLandmarks) };
+	}
+}
+
+#endif
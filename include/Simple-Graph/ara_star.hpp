@@ -0,0 +1,525 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_ARA_STAR_HPP
+#define SIMPLE_GRAPH_ARA_STAR_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <map>
+#include <optional>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::ara_star
+{
+	/** \addtogroup ara_star
+	* @{
+	* \brief Provides the anytime repairing A* (ARA*).
+	* \details The algorithm starts with a heavily inflated heuristic, which quickly yields a suboptimal path. Afterwards the inflation
+	* factor is decreased step by step, while the previous search effort is reused. Each improved path is published through the callback,
+	* thus users may abort the search as soon as their time budget is exceeded and still use the best path found so far.
+	*/
+
+	/**
+	 * \brief The state type of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	struct state_t
+	{
+		/**
+		 * \brief The best known cost from the begin vertex; ``std::nullopt`` denotes infinity.
+		 */
+		std::optional<TWeight> weight_sum{};
+
+		/**
+		 * \brief The predecessor on the best known path.
+		 */
+		std::optional<TVertex> predecessor{};
+
+		/**
+		 * \brief The iteration in which the vertex has been expanded most recently; 0 means never.
+		 */
+		std::size_t expandedIteration{ 0 };
+
+		/**
+		 * \brief Determines whether the vertex has been improved after its expansion in the current iteration.
+		 */
+		bool inconsistent{ false };
+
+		[[nodiscard]]
+		constexpr bool operator ==(const state_t& other) const noexcept = default;
+	};
+
+	/**
+	 * \brief The solution type, which is published for each improved path.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	struct solution_t
+	{
+		/**
+		 * \brief The path in reversed order (destination first).
+		 */
+		std::vector<TVertex> path{};
+
+		/**
+		 * \brief The cost of the path.
+		 */
+		TWeight weight_sum{};
+
+		/**
+		 * \brief The proven suboptimality bound, thus the cost is at most ``epsilon`` times the optimal cost.
+		 */
+		double epsilon{};
+	};
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \tparam THeuristic The heuristic type.
+	 * \tparam TCallback The callback type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TStateMap The state map type.
+	 */
+	template <
+		vertex_descriptor TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator,
+		astar::compatible_heuristic_for<TVertex, TWeightCalculator> THeuristic,
+		class TCallback = empty_invokable_t,
+		vertex_predicate_for<astar::node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TVertexPredicate = true_constant_t,
+		state_map_for<TVertex, state_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TStateMap
+		= std::map<TVertex, state_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>>>
+		requires std::invocable<TCallback, const solution_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>&>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::remove_cvref_t<TVertex>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = detail::astar_node<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the solution type.
+		 */
+		using solution_t = ara_star::solution_t<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the heuristic type.
+		 */
+		using heuristic_t = THeuristic;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = std::remove_cvref_t<TStateMap>;
+
+		/**
+		 * \brief The vertex to start the search.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The vertex to be reached.
+		 */
+		TVertex destination{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The heuristic to be used. Must be an invokable type, which returns the estimated remaining cost between the current vertex and
+		 * the destination.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must neither be less than zero nor overestimate the cost to the destination. Otherwise the
+		 * published suboptimality bounds do not hold.
+		 */
+		THeuristic heuristic{};
+
+		/**
+		 * \brief The callback object to be invoked for each improved path.
+		 * \remark If not set, an empty_invokable_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * void operator()(const solution_t& solution)
+		 * \endcode
+		 *
+		 * Alternatively the invoke operator may return a boolean-convertible type, where true indicates that the algorithm shall
+		 * be aborted.
+		 */
+		TCallback callback{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each discovered vertex.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether a vertex shall be further investigated, where false means it will be skipped.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The state map prototype object.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \see state_map_for concept for the actual type requirements.
+		 */
+		TStateMap stateMap{};
+
+		/**
+		 * \brief The inflation factor of the first iteration. Must be greater or equal 1.
+		 */
+		double initialEpsilon{ 3. };
+
+		/**
+		 * \brief The amount the inflation factor is decreased after each iteration. Must be greater than 0.
+		 */
+		double epsilonStep{ 0.5 };
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TParams>
+	class ara_star_engine
+	{
+	public:
+		using vertex_t = typename TParams::vertex_t;
+		using weight_t = typename TParams::weight_t;
+		using node_t = typename TParams::node_t;
+		using solution_t = typename TParams::solution_t;
+
+		explicit ara_star_engine(TParams& params)
+			: m_Params{ params }
+		{
+		}
+
+		void run()
+		{
+			assert(1. <= m_Params.initialEpsilon && "initialEpsilon must be greater or equal 1.");
+			assert(0. < m_Params.epsilonStep && "epsilonStep must be greater than 0.");
+
+			m_Epsilon = m_Params.initialEpsilon;
+			state(m_Params.begin).weight_sum = weight_t{};
+			push(m_Params.begin, weight_t{});
+
+			for (std::size_t iteration{ 1 };; ++iteration)
+			{
+				improve_path(iteration);
+
+				// destination is unreachable
+				if (!state(m_Params.destination).weight_sum)
+					return;
+
+				if (publish(iteration))
+					return;
+
+				if (m_Epsilon <= 1.)
+					return;
+
+				m_Epsilon = std::max(1., m_Epsilon - m_Params.epsilonStep);
+				reopen();
+			}
+		}
+
+	private:
+		using entry_t = std::tuple<weight_t, weight_t, vertex_t>;
+
+		TParams& m_Params;
+		double m_Epsilon{};
+		std::priority_queue<entry_t, std::vector<entry_t>, std::greater<>> m_OpenList{};
+		std::vector<vertex_t> m_Inconsistent{};
+		std::optional<std::tuple<weight_t, double>> m_LastPublished{};
+
+		[[nodiscard]]
+		auto& state(const vertex_t& v)
+		{
+			return m_Params.stateMap[v];
+		}
+
+		[[nodiscard]]
+		weight_t estimate(const vertex_t& v) const
+		{
+			const weight_t estimated{ std::invoke(m_Params.heuristic, v) };
+			assert(weight_t{} <= estimated && "estimated weight must be greater or equal zero.");
+			return estimated;
+		}
+
+		void push(const vertex_t& v, const weight_t& weightSum)
+		{
+			const astar::inflated_heuristic_t heuristic
+			{
+				.heuristic = std::cref(m_Params.heuristic),
+				.factor = m_Epsilon
+			};
+			m_OpenList.emplace(weightSum + heuristic(v), weightSum, v);
+		}
+
+		// an entry is stale, if the vertex has been improved or expanded since
+		[[nodiscard]]
+		bool is_stale(const entry_t& entry, std::size_t iteration)
+		{
+			const auto& [key, weightSum, v] = entry;
+			const auto& curState = state(v);
+			return curState.expandedIteration == iteration || curState.weight_sum != weightSum;
+		}
+
+		void improve_path(std::size_t iteration)
+		{
+			while (!std::empty(m_OpenList))
+			{
+				const entry_t entry{ m_OpenList.top() };
+				if (is_stale(entry, iteration))
+				{
+					m_OpenList.pop();
+					continue;
+				}
+
+				const auto& [key, weightSum, v] = entry;
+				if (const auto& destination = state(m_Params.destination);
+					destination.weight_sum && !(key < *destination.weight_sum))
+					return;
+
+				m_OpenList.pop();
+				state(v).expandedIteration = iteration;
+
+				const node_t predecessor{ .predecessor = state(v).predecessor, .vertex = v, .weight_sum = weightSum };
+				for (const vertex_t& cur_vertex : std::invoke(m_Params.neighborSearcher, v))
+				{
+					if (!std::invoke(m_Params.vertexPredicate, predecessor, cur_vertex))
+						continue;
+
+					const weight_t rel_weight{ std::invoke(m_Params.weightCalculator, v, cur_vertex) };
+					assert(weight_t{} <= rel_weight && "relative weight between nodes must be greater or equal zero.");
+
+					auto& curState = state(cur_vertex);
+					if (const weight_t cur_weight{ weightSum + rel_weight }; !curState.weight_sum || cur_weight < *curState.weight_sum)
+					{
+						curState.weight_sum = cur_weight;
+						curState.predecessor = v;
+						if (curState.expandedIteration != iteration)
+						{
+							push(cur_vertex, cur_weight);
+						}
+						else if (!std::exchange(curState.inconsistent, true))
+						{
+							m_Inconsistent.emplace_back(cur_vertex);
+						}
+					}
+				}
+			}
+		}
+
+		// merges the inconsistent vertices into the open list and recalculates all keys
+		void reopen()
+		{
+			std::vector<vertex_t> vertices{ std::move(m_Inconsistent) };
+			m_Inconsistent.clear();
+			for (; !std::empty(m_OpenList); m_OpenList.pop())
+			{
+				const auto& [key, weightSum, v] = m_OpenList.top();
+				if (state(v).weight_sum == weightSum)
+				{
+					vertices.emplace_back(v);
+				}
+			}
+
+			for (const vertex_t& v : vertices)
+			{
+				auto& curState = state(v);
+				curState.inconsistent = false;
+				push(v, *curState.weight_sum);
+			}
+		}
+
+		// publishes the solution, if it improved; returns true, if the search shall be aborted
+		bool publish(std::size_t iteration)
+		{
+			// vertices on the path may have been improved after their successors, thus the actual cost may be less than g(destination)
+			solution_t solution{ .path = { m_Params.destination } };
+			while (solution.path.back() != m_Params.begin)
+			{
+				const vertex_t& current = solution.path.back();
+				const vertex_t& predecessor = *state(current).predecessor;
+				solution.weight_sum += std::invoke(m_Params.weightCalculator, predecessor, current);
+				solution.path.emplace_back(predecessor);
+			}
+
+			// the least not inflated key of all open and inconsistent vertices is a lower bound for the optimal cost
+			std::optional<weight_t> lowerBound{};
+			const auto updateBound = [&](const vertex_t& v, const weight_t& curWeight)
+			{
+				if (const weight_t bound{ curWeight + estimate(v) }; !lowerBound || bound < *lowerBound)
+				{
+					lowerBound = bound;
+				}
+			};
+
+			for (const vertex_t& v : m_Inconsistent)
+			{
+				updateBound(v, *state(v).weight_sum);
+			}
+
+			for (auto openList{ m_OpenList }; !std::empty(openList); openList.pop())
+			{
+				if (const entry_t& entry = openList.top(); !is_stale(entry, iteration))
+				{
+					updateBound(std::get<2>(entry), std::get<1>(entry));
+				}
+			}
+
+			solution.epsilon = m_Epsilon;
+			if (!lowerBound || !(*lowerBound < solution.weight_sum))
+			{
+				solution.epsilon = 1.;
+			}
+			else if (weight_t{} < *lowerBound)
+			{
+				solution.epsilon = std::min(m_Epsilon, static_cast<double>(solution.weight_sum) / static_cast<double>(*lowerBound));
+			}
+
+			// no further improvement is possible
+			if (solution.epsilon <= 1.)
+			{
+				m_Epsilon = 1.;
+			}
+
+			if (m_LastPublished)
+			{
+				if (const auto& [lastWeight, lastEpsilon] = *m_LastPublished;
+					!(solution.weight_sum < lastWeight) && !(solution.epsilon < lastEpsilon))
+					return false;
+			}
+			m_LastPublished.emplace(solution.weight_sum, solution.epsilon);
+
+			return shall_interrupt(m_Params.callback, std::as_const(solution));
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Overload for ara_star::search_params.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \details The search stops after a path with epsilon 1 has been published, the callback requested the abort or the destination
+	 * is unreachable.
+	 * \ingroup ara_star
+	 */
+	template <class... TArgs>
+	void traverse(ara_star::search_params<TArgs...> params)
+	{
+		detail::ara_star_engine{ params }.run();
+	}
+
+	/**
+	 * \brief Executes the algorithm and returns the best found path.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns the last published solution, or ``std::nullopt`` if destination is unreachable.
+	 * \details The callback is still invoked for each improved path.
+	 * \ingroup ara_star
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	std::optional<typename ara_star::search_params<TArgs...>::solution_t> find_path(ara_star::search_params<TArgs...> params)
+	{
+		using solution_t = typename ara_star::search_params<TArgs...>::solution_t;
+
+		std::optional<solution_t> result{};
+		auto callback = std::move(params.callback);
+		traverse
+		(
+			ara_star::search_params
+			{
+				.begin = std::move(params.begin),
+				.destination = std::move(params.destination),
+				.neighborSearcher = std::ref(params.neighborSearcher),
+				.weightCalculator = std::ref(params.weightCalculator),
+				.heuristic = std::ref(params.heuristic),
+				.callback = [&](const solution_t& solution)
+				{
+					result = solution;
+					return detail::shall_interrupt(callback, solution);
+				},
+				.vertexPredicate = std::ref(params.vertexPredicate),
+				.stateMap = std::move(params.stateMap),
+				.initialEpsilon = params.initialEpsilon,
+				.epsilonStep = params.epsilonStep
+			}
+		);
+		return result;
+	}
+}
+
+#endif
@@ -0,0 +1,412 @@
+//           Copyright Dominic Koepke 2019 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_BATCH_HPP
+#define SIMPLE_GRAPH_BATCH_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "generic_traverse.hpp"
+#include "parallel_helper.hpp"
+#include "path_finder.hpp"
+#include "queue_helper.hpp"
+#include "utility.hpp"
+
+#include <cassert>
+#include <functional>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace sl::graph::batch
+{
+	/** \addtogroup batch
+	* @{
+	* \brief Provides the search_params and other related things for answering many independent path queries at once.
+	*/
+
+	/**
+	 * \brief A single path query.
+	 * \tparam TVertex The vertex type.
+	 */
+	template <vertex_descriptor TVertex>
+	struct query_t
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief The vertex to start the search.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The vertex to find the path to.
+		 */
+		TVertex destination{};
+	};
+
+	/**
+	 * \brief The node type of the algorithm.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using node_t = astar::node_t<TVertex, TWeight>;
+
+	/**
+	 * \brief The state type of the algorithm.
+	 */
+	template <weight TWeight>
+	using state_t = astar::state_t<TWeight>;
+
+	/**
+	 * \brief The default open list type of the algorithm.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using default_open_list_t = astar::default_open_list_t<TVertex, TWeight>;
+
+	/**
+	 * \brief The default heuristic factory, which makes each query an ordinary dijkstra search.
+	 */
+	struct zero_heuristic_factory_t
+	{
+		template <class TVertex>
+		[[nodiscard]]
+		constexpr constant_t<0> operator ()(const TVertex&) const noexcept
+		{
+			return {};
+		}
+	};
+
+	/**
+	 * \brief Checks whether a type is a range of queries.
+	 * \tparam T Type to check.
+	 */
+	template <class T>
+	concept query_range = std::ranges::random_access_range<T>
+						&& std::ranges::sized_range<T>
+						&& std::same_as<
+							std::ranges::range_value_t<T>,
+							query_t<typename std::ranges::range_value_t<T>::vertex_t>>;
+
+	/**
+	 * \brief Alias for the vertex type of a query range.
+	 */
+	template <query_range TQueries>
+	using query_vertex_t = typename std::ranges::range_value_t<TQueries>::vertex_t;
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TQueries The query range type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \tparam THeuristicFactory The heuristic factory type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TStateMap The state map type.
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \tparam TOpenList The open list type.
+	 */
+	template <
+		query_range TQueries,
+		neighbor_searcher_for<query_vertex_t<TQueries>> TNeighborSearcher,
+		weight_calculator_for<query_vertex_t<TQueries>> TWeightCalculator,
+		std::invocable<const query_vertex_t<TQueries>&> THeuristicFactory = zero_heuristic_factory_t,
+		vertex_predicate_for<node_t<query_vertex_t<TQueries>, detail::weight_type_of_t<TWeightCalculator, query_vertex_t<TQueries>>>>
+		TVertexPredicate = true_constant_t,
+		state_map_for<query_vertex_t<TQueries>, state_t<detail::weight_type_of_t<TWeightCalculator, query_vertex_t<TQueries>>>> TStateMap
+		= std::map<query_vertex_t<TQueries>, state_t<detail::weight_type_of_t<TWeightCalculator, query_vertex_t<TQueries>>>>,
+		predecessor_map_for<query_vertex_t<TQueries>> TPredecessorMap
+		= std::map<query_vertex_t<TQueries>, std::optional<query_vertex_t<TQueries>>>,
+		open_list_for<node_t<query_vertex_t<TQueries>, detail::weight_type_of_t<TWeightCalculator, query_vertex_t<TQueries>>>> TOpenList
+		= default_open_list_t<query_vertex_t<TQueries>, detail::weight_type_of_t<TWeightCalculator, query_vertex_t<TQueries>>>>
+		requires astar::compatible_heuristic_for<
+			std::invoke_result_t<const THeuristicFactory&, const query_vertex_t<TQueries>&>,
+			query_vertex_t<TQueries>,
+			TWeightCalculator>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = query_vertex_t<TQueries>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, vertex_t>;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = batch::node_t<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the query range type.
+		 */
+		using queries_t = TQueries;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the heuristic factory type.
+		 */
+		using heuristic_factory_t = THeuristicFactory;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = std::remove_cvref_t<TStateMap>;
+
+		/**
+		 * \brief Alias for the predecessor map type.
+		 */
+		using predecessor_map_t = std::remove_cvref_t<TPredecessorMap>;
+
+		/**
+		 * \brief Alias for the open list type.
+		 */
+		using open_list_t = std::remove_cvref_t<TOpenList>;
+
+		/**
+		 * \brief The queries to be answered. A ``std::span<const query_t<vertex_t>>`` is usually the best fit.
+		 */
+		TQueries queries{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 * \note Each worker thread invokes its own copy.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 * \note Each worker thread invokes its own copy.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The factory, which creates the heuristic for each query.
+		 * \remark If not set, a zero_heuristic_factory_t object is used, thus each query performs a plain dijkstra search.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * heuristic operator()(const vertex_t& destination)
+		 * \endcode
+		 * where the returned heuristic must satisfy the astar::compatible_heuristic_for concept.
+		 * \note Each worker thread invokes its own copy.
+		 */
+		THeuristicFactory heuristicFactory{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each discovered vertex.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether a vertex shall be further investigated, where false means it will be skipped.
+		 * \note Each worker thread invokes its own copy.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The state map prototype object. Each worker thread copies it once and reuses it for all of its queries.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \attention The prototype must not contain any graph state. It gets reset via ``clear`` in between the queries, which
+		 * is a linear operation on random access containers. Thus dense maps are only beneficial, if the queries explore a
+		 * significant part of the graph.
+		 */
+		TStateMap stateMap{};
+
+		/**
+		 * \brief The predecessor map prototype object. Each worker thread copies it once and reuses it for all of its queries.
+		 * \note If not explicitly set, a ``std::map`` is used, thus the vertex type must be less-comparable.
+		 * \attention The same restrictions as for the stateMap apply.
+		 */
+		TPredecessorMap predecessorMap{};
+
+		/**
+		 * \brief The open list prototype object. Each worker thread copies it once and reuses it for all of its queries.
+		 * \note If not explicitly set, a ``std::priority_queue`` is used.
+		 * \see open_list_for concept for the actual type requirements.
+		 */
+		TOpenList openList{};
+
+		/**
+		 * \brief The number of worker threads. Zero means one worker per hardware thread.
+		 */
+		std::size_t threadCount{ 1 };
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TParams>
+	struct batch_workspace
+	{
+		using vertex_t = typename TParams::vertex_t;
+		using node_t = typename TParams::node_t;
+
+		typename TParams::neighbor_searcher_t neighborSearcher;
+		typename TParams::weight_calculator_t weightCalculator;
+		typename TParams::heuristic_factory_t heuristicFactory;
+		typename TParams::vertex_predicate_t vertexPredicate;
+		typename TParams::state_map_t stateMap;
+		typename TParams::predecessor_map_t predecessorMap;
+		typename TParams::open_list_t openList;
+
+		explicit batch_workspace(const TParams& params)
+			: neighborSearcher{ params.neighborSearcher },
+			weightCalculator{ params.weightCalculator },
+			heuristicFactory{ params.heuristicFactory },
+			vertexPredicate{ params.vertexPredicate },
+			stateMap{ params.stateMap },
+			predecessorMap{ params.predecessorMap },
+			openList{ params.openList }
+		{
+		}
+
+		void find_path(const batch::query_t<vertex_t>& query, std::optional<std::vector<vertex_t>>& result)
+		{
+			// an interrupted search leaves its nodes behind, thus the workspace must be reset before and not after each query
+			clear(stateMap);
+			clear(predecessorMap);
+			clear(openList);
+
+			bool success{ false };
+			dynamic_cost_traverse<node_t>
+			(
+				make_astar_node_factory<vertex_t>(std::ref(weightCalculator), std::invoke(heuristicFactory, query.destination)),
+				{ .vertex = query.begin },
+				std::ref(neighborSearcher),
+				[&](const node_t& node)
+				{
+					predecessorMap[node.vertex] = node.predecessor;
+					success = node.vertex == query.destination;
+					return success;
+				},
+				std::ref(vertexPredicate),
+				stateMap,
+				openList
+			);
+
+			if (!success)
+			{
+				result.reset();
+				return;
+			}
+
+			// reuse the already allocated memory of the output, if there is any
+			auto& path = result ? *result : result.emplace();
+			path.clear();
+			path.emplace_back(query.destination);
+			for (auto predecessor = predecessorMap[query.destination]; predecessor; predecessor = predecessorMap[*predecessor])
+			{
+				path.emplace_back(*predecessor);
+			}
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Answers each query of the batch and stores the results into the provided output.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \param results The output, which must provide exactly one element per query. Each element will be set to the path of the
+	 * corresponding query or ``std::nullopt``, if the destination is unreachable.
+	 * \details The queries are distributed over ``threadCount`` worker threads. Each worker owns a workspace, which consists of
+	 * copies of all search_params members except the queries, and reuses it for each of its queries. Workers, which run out
+	 * of queries, steal half of the remaining queries of another worker, thus a few expensive queries do not stall the
+	 * whole batch.
+	 * \note The paths will be ordered from destination to begin, thus reversed. Already engaged elements of the output keep
+	 * their allocated memory.
+	 * \attention All the copied function objects of one batch will be invoked concurrently. If they share any mutable state, the
+	 * behaviour is undefined.
+	 * \ingroup batch
+	 */
+	template <class... TArgs>
+	void find_paths
+	(
+		const batch::search_params<TArgs...>& params,
+		std::span<std::optional<std::vector<typename batch::search_params<TArgs...>::vertex_t>>> results
+	)
+	{
+		using params_t = batch::search_params<TArgs...>;
+
+		assert(std::ranges::size(params.queries) == std::size(results) && "There must be exactly one result per query.");
+
+		const std::size_t threadCount{ std::min(detail::resolve_thread_count(params.threadCount), std::size(results)) };
+		std::vector<detail::batch_workspace<params_t>> workspaces{};
+		workspaces.reserve(threadCount);
+		for (std::size_t i{ 0 }; i < threadCount; ++i)
+		{
+			workspaces.emplace_back(params);
+		}
+
+		detail::work_stealing_for
+		(
+			threadCount,
+			std::size(results),
+			[&](const std::size_t threadIndex, const std::size_t i)
+			{
+				workspaces[threadIndex].find_path(std::ranges::begin(params.queries)[i], results[i]);
+			}
+		);
+	}
+
+	/**
+	 * \brief Answers each query of the batch.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns a vector with one element per query, which is either the path or ``std::nullopt``.
+	 * \see The overload with a preallocated output for details.
+	 * \ingroup batch
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	std::vector<std::optional<std::vector<typename batch::search_params<TArgs...>::vertex_t>>> find_paths
+	(
+		const batch::search_params<TArgs...>& params
+	)
+	{
+		std::vector<std::optional<std::vector<typename batch::search_params<TArgs...>::vertex_t>>> results(
+			std::ranges::size(params.queries)
+		);
+		find_paths(params, std::span{ results });
+		return results;
+	}
+}
+
+#endif
@@ -0,0 +1,238 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_BOUNDED_OPEN_LIST_HPP
+#define SIMPLE_GRAPH_BOUNDED_OPEN_LIST_HPP
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace sl::graph
+{
+	/** \addtogroup bounded_open_list
+	* @{
+	* \brief Provides an open list with a fixed capacity, which turns dijkstra and astar into a beam search.
+	* \details Whenever a node is inserted into the full open list, the worst node (either the inserted or the worst stored one) is
+	* pruned. Thus the memory and the time of each step is bounded, but the algorithms may no longer find the optimal path or any
+	* path at all.
+	*/
+
+	/**
+	 * \brief Statistics of a bounded_open_list.
+	 */
+	struct open_list_statistics
+	{
+		/**
+		 * \brief The amount of inserted nodes.
+		 */
+		std::size_t insertions{ 0 };
+
+		/**
+		 * \brief The amount of nodes, which have been pruned due to the capacity.
+		 */
+		std::size_t pruned{ 0 };
+
+		/**
+		 * \brief The highest amount of nodes stored at once.
+		 */
+		std::size_t peakSize{ 0 };
+
+		[[nodiscard]]
+		constexpr bool operator ==(const open_list_statistics&) const noexcept = default;
+	};
+
+	/**
+	 * \brief Priority-queue-like open list with a fixed capacity.
+	 * \tparam TNode The node type.
+	 * \tparam TCompare The comparison type. The least node is taken next.
+	 * \details The nodes are kept sorted, where the best node is stored at the end; thus taking the next node is constant, while
+	 * inserting is linear in the capacity. This is the preferable trade-off for small beam widths.
+	 */
+	template <class TNode, class TCompare = std::less<>>
+	class bounded_open_list
+	{
+	public:
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using value_type = TNode;
+
+		/**
+		 * \brief Constructor.
+		 * \param capacity The maximal amount of stored nodes. Must be greater than zero.
+		 * \param statistics Optional statistics object, which will be updated during the traversal.
+		 * \param compare The comparison object.
+		 * \note The open list gets moved into the algorithm, thus the statistics object must be provided externally.
+		 */
+		explicit bounded_open_list(std::size_t capacity, open_list_statistics* statistics = nullptr, TCompare compare = {})
+			: m_Capacity{ capacity },
+			m_Statistics{ statistics },
+			m_Compare{ std::move(compare) }
+		{
+			assert(0 < capacity && "capacity must be greater than zero.");
+
+			m_Nodes.reserve(capacity + 1);
+		}
+
+		/**
+		 * \brief Returns the capacity.
+		 */
+		[[nodiscard]]
+		std::size_t capacity() const noexcept
+		{
+			return m_Capacity;
+		}
+
+		/**
+		 * \brief Returns the amount of stored nodes.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept
+		{
+			return std::size(m_Nodes);
+		}
+
+		/**
+		 * \brief Determines whether any nodes are stored.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept
+		{
+			return std::empty(m_Nodes);
+		}
+
+		/**
+		 * \brief Returns the best node.
+		 */
+		[[nodiscard]]
+		const TNode& top() const noexcept
+		{
+			assert(!empty());
+			return m_Nodes.back();
+		}
+
+		/**
+		 * \brief Inserts the node. If the capacity is exceeded, the worst node is pruned.
+		 */
+		void push(TNode node)
+		{
+			if (m_Statistics)
+				++m_Statistics->insertions;
+
+			// nodes are ordered from worst to best
+			const auto itr = std::ranges::upper_bound
+			(
+				m_Nodes,
+				node,
+				[&](const TNode& lhs, const TNode& rhs) { return std::invoke(m_Compare, rhs, lhs); }
+			);
+
+			if (m_Capacity <= std::size(m_Nodes))
+			{
+				if (m_Statistics)
+					++m_Statistics->pruned;
+
+				if (itr == std::begin(m_Nodes))
+					return;
+
+				// shifts all worse nodes one step towards the begin, which overwrites the worst one
+				std::move(std::next(std::begin(m_Nodes)), itr, std::begin(m_Nodes));
+				*std::prev(itr) = std::move(node);
+				return;
+			}
+
+			m_Nodes.insert(itr, std::move(node));
+			if (m_Statistics)
+				m_Statistics->peakSize = std::max(m_Statistics->peakSize, std::size(m_Nodes));
+		}
+
+		/**
+		 * \brief Removes the best node.
+		 */
+		void pop()
+		{
+			assert(!empty());
+			m_Nodes.pop_back();
+		}
+
+		/**
+		 * \brief Removes all nodes, but keeps the allocated memory.
+		 */
+		void clear() noexcept
+		{
+			m_Nodes.clear();
+		}
+
+	private:
+		std::size_t m_Capacity;
+		open_list_statistics* m_Statistics;
+		TCompare m_Compare;
+		std::vector<TNode> m_Nodes{};
+	};
+
+	/** @}*/
+}
+
+/** \addtogroup bounded_open_list
+* @{
+*/
+
+/**
+ * \brief Specialization for bounded_open_list.
+ * \tparam TArgs Template arguments for bounded_open_list.
+ */
+template <class... TArgs>
+struct sl::graph::take_next_t<sl::graph::bounded_open_list<TArgs...>>
+{
+	using container_t = bounded_open_list<TArgs...>;
+	using value_t = typename container_t::value_type;
+
+	/**
+	 * \brief The invocation operator. Retrieves, removes and returns the next element.
+	 * \param container The container object.
+	 * \return Returns the next element.
+	 */
+	[[nodiscard]]
+	constexpr value_t operator ()(container_t& container) const
+	{
+		auto el{ container.top() };
+		container.pop();
+		return el;
+	}
+};
+
+/**
+ * \brief Specialization for bounded_open_list.
+ * \tparam TArgs Template arguments for bounded_open_list.
+ */
+template <class... TArgs>
+struct sl::graph::emplace_t<sl::graph::bounded_open_list<TArgs...>>
+{
+	using container_t = bounded_open_list<TArgs...>;
+	using value_t = typename container_t::value_type;
+
+	/**
+	 * \brief The invocation operator. Constructs the node from the given arguments and inserts it.
+	 * \tparam TCTorArgs The types of the provided constructor arguments.
+	 * \param container The container object.
+	 * \param args The provided constructor arguments.
+	 */
+	template <class... TCTorArgs>
+	constexpr void operator ()(container_t& container, TCTorArgs&&... args) const
+	{
+		container.push(value_t{ std::forward<TCTorArgs>(args)... });
+	}
+};
+
+/** @}*/
+
+#endif
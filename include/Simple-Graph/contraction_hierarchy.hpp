@@ -0,0 +1,813 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_CONTRACTION_HIERARCHY_HPP
+#define SIMPLE_GRAPH_CONTRACTION_HIERARCHY_HPP
+
+#pragma once
+
+#include "csr_graph.hpp"
+#include "parallel_helper.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::ch
+{
+	/** \addtogroup contraction_hierarchy
+	* @{
+	* \brief Provides the preprocessing and query of contraction hierarchies for fast point-to-point shortest path queries on
+	* static graphs.
+	* \details During preprocessing all vertices get contracted one after another, where each contraction inserts shortcut edges
+	* between the remaining neighbors of the contracted vertex, if no equally short witness path exists. The contraction order
+	* (rank) is determined by a priority (edge difference), and independent sets of vertices with locally minimal priority are
+	* contracted in parallel.
+	* Queries run a bidirectional dijkstra, which only relaxes edges towards higher ranked vertices. Thus, a query usually settles
+	* just a few hundred vertices, even on huge graphs.
+	* Contraction hierarchies operate on graphs with dense vertex ids, thus each vertex must be an integral value in the range
+	* ``[0, vertexCount)``.
+	*/
+
+	/**
+	 * \brief The result type of the preprocessing.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	struct hierarchy_t
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the graph type.
+		 */
+		using graph_t = csr_graph<TVertex, TWeight>;
+
+		/**
+		 * \brief Denotes edges, which are no shortcuts.
+		 */
+		static constexpr TVertex no_middle{ std::numeric_limits<TVertex>::max() };
+
+		/**
+		 * \brief The rank of each vertex, indexed by its id.
+		 */
+		std::vector<std::size_t> ranks{};
+
+		/**
+		 * \brief All edges ``v -> w`` with ``ranks[v] < ranks[w]``, stored at v.
+		 */
+		graph_t upward{};
+
+		/**
+		 * \brief The contracted vertex of each upward edge, or ``no_middle`` if it's an original edge.
+		 */
+		std::vector<TVertex> upwardMiddles{};
+
+		/**
+		 * \brief All edges ``u -> v`` with ``ranks[v] < ranks[u]``, stored reversed at v. This is the search graph of the
+		 * backward search.
+		 */
+		graph_t downward{};
+
+		/**
+		 * \brief The contracted vertex of each downward edge, or ``no_middle`` if it's an original edge.
+		 */
+		std::vector<TVertex> downwardMiddles{};
+
+		/**
+		 * \brief Returns the amount of vertices.
+		 */
+		[[nodiscard]]
+		std::size_t vertex_count() const noexcept
+		{
+			return std::size(ranks);
+		}
+	};
+
+	/**
+	 * \brief The params of the preprocessing.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+		requires std::is_arithmetic_v<TWeight>
+	struct build_params
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the result type.
+		 */
+		using hierarchy_t = ch::hierarchy_t<TVertex, TWeight>;
+
+		/**
+		 * \brief The graph to be contracted. Use ``make_csr_graph`` for creating it from a neighbor searcher and weight calculator.
+		 * \attention All weights must be greater or equal to zero.
+		 */
+		csr_graph<TVertex, TWeight> graph{};
+
+		/**
+		 * \brief The amount of threads to be used. If set to 0, ``std::thread::hardware_concurrency`` is used.
+		 */
+		std::size_t threadCount{ 1 };
+
+		/**
+		 * \brief The maximal amount of vertices settled by a single witness search.
+		 * \details Aborted witness searches result in (possibly unnecessary) shortcuts. Smaller values speed up the preprocessing,
+		 * but may slow down the queries.
+		 */
+		std::size_t witnessSettleLimit{ 500 };
+	};
+
+	/**
+	 * \brief Reusable query object for a hierarchy.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \details Holds all buffers needed for the queries, thus subsequent queries don't need to allocate. Each thread should use
+	 * its own query object.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	class query_t
+	{
+	public:
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the hierarchy type.
+		 */
+		using hierarchy_t = ch::hierarchy_t<TVertex, TWeight>;
+
+		/**
+		 * \brief Constructor.
+		 * \param hierarchy The hierarchy to be queried. Must outlive this object.
+		 */
+		explicit query_t(const hierarchy_t& hierarchy)
+			: m_Hierarchy{ &hierarchy },
+			m_Forward{ hierarchy.vertex_count() },
+			m_Backward{ hierarchy.vertex_count() }
+		{
+		}
+
+		/**
+		 * \brief Computes the shortest distance between both vertices.
+		 * \param begin The begin vertex.
+		 * \param destination The destination vertex.
+		 * \return Returns the distance, or ``std::nullopt`` if destination is unreachable.
+		 */
+		[[nodiscard]]
+		std::optional<TWeight> distance(const TVertex& begin, const TVertex& destination)
+		{
+			if (run(begin, destination))
+				return m_Best;
+			return std::nullopt;
+		}
+
+		/**
+		 * \brief Computes the shortest path between both vertices. All shortcuts are unpacked.
+		 * \param begin The begin vertex.
+		 * \param destination The destination vertex.
+		 * \return Returns the path in reversed order (destination first), or ``std::nullopt`` if destination is unreachable.
+		 */
+		[[nodiscard]]
+		std::optional<std::vector<TVertex>> find_path(const TVertex& begin, const TVertex& destination)
+		{
+			if (!run(begin, destination))
+				return std::nullopt;
+
+			// collect the vertices of the hierarchy path in forward order
+			std::vector<TVertex> hierarchyPath{};
+			for (std::optional<TVertex> v{ m_Meeting }; v; v = m_Forward.predecessors[index(*v)])
+			{
+				hierarchyPath.emplace_back(*v);
+			}
+			std::ranges::reverse(hierarchyPath);
+			for (std::optional<TVertex> v{ m_Backward.predecessors[index(m_Meeting)] }; v; v = m_Backward.predecessors[index(*v)])
+			{
+				hierarchyPath.emplace_back(*v);
+			}
+
+			std::vector<TVertex> path{ hierarchyPath.front() };
+			for (std::size_t i{ 1 }; i < std::size(hierarchyPath); ++i)
+			{
+				unpack(hierarchyPath[i - 1], hierarchyPath[i], path);
+			}
+			std::ranges::reverse(path);
+			return { std::move(path) };
+		}
+
+	private:
+		static constexpr TWeight infinity{ std::numeric_limits<TWeight>::max() };
+
+		struct direction_t
+		{
+			explicit direction_t(std::size_t vertexCount)
+				: distances(vertexCount, infinity),
+				predecessors(vertexCount)
+			{
+			}
+
+			std::vector<TWeight> distances;
+			std::vector<std::optional<TVertex>> predecessors;
+			std::vector<TVertex> touched{};
+			std::priority_queue<std::tuple<TWeight, TVertex>, std::vector<std::tuple<TWeight, TVertex>>, std::greater<>> queue{};
+
+			void reset()
+			{
+				for (const TVertex& v : touched)
+				{
+					distances[index(v)] = infinity;
+					predecessors[index(v)].reset();
+				}
+				touched.clear();
+				queue = {};
+			}
+
+			void seed(const TVertex& v)
+			{
+				distances[index(v)] = TWeight{};
+				touched.emplace_back(v);
+				queue.emplace(TWeight{}, v);
+			}
+		};
+
+		const hierarchy_t* m_Hierarchy;
+		direction_t m_Forward;
+		direction_t m_Backward;
+		TWeight m_Best{};
+		TVertex m_Meeting{};
+
+		[[nodiscard]]
+		static constexpr std::size_t index(const TVertex& v) noexcept
+		{
+			return static_cast<std::size_t>(v);
+		}
+
+		[[nodiscard]]
+		bool run(const TVertex& begin, const TVertex& destination)
+		{
+			assert(index(begin) < m_Hierarchy->vertex_count() && "begin is out of range.");
+			assert(index(destination) < m_Hierarchy->vertex_count() && "destination is out of range.");
+
+			m_Forward.reset();
+			m_Backward.reset();
+			m_Forward.seed(begin);
+			m_Backward.seed(destination);
+			m_Best = infinity;
+			if (begin == destination)
+			{
+				m_Best = TWeight{};
+				m_Meeting = begin;
+			}
+
+			// each direction may stop, as soon as its least tentative distance exceeds the best known path
+			const auto is_done = [&](const direction_t& dir)
+			{
+				return std::empty(dir.queue) || !(std::get<0>(dir.queue.top()) < m_Best);
+			};
+
+			for (bool forward{ true }; !is_done(m_Forward) || !is_done(m_Backward); forward = !forward)
+			{
+				if (forward && !is_done(m_Forward))
+				{
+					settle_next(m_Forward, m_Backward, m_Hierarchy->upward);
+				}
+				else if (!forward && !is_done(m_Backward))
+				{
+					settle_next(m_Backward, m_Forward, m_Hierarchy->downward);
+				}
+			}
+			return m_Best != infinity;
+		}
+
+		void settle_next(direction_t& dir, const direction_t& opposite, const typename hierarchy_t::graph_t& graph)
+		{
+			const auto [distance, v] = dir.queue.top();
+			dir.queue.pop();
+			if (dir.distances[index(v)] < distance)
+				return;
+
+			const std::span<const TVertex> neighbors{ graph.neighbors(v) };
+			const std::span<const TWeight> weights{ graph.neighbor_weights(v) };
+			for (std::size_t i{ 0 }; i < std::size(neighbors); ++i)
+			{
+				const TVertex& cur_vertex = neighbors[i];
+				const TWeight cur_distance{ distance + weights[i] };
+				TWeight& cur_tentative = dir.distances[index(cur_vertex)];
+				if (cur_distance < cur_tentative)
+				{
+					if (cur_tentative == infinity)
+					{
+						dir.touched.emplace_back(cur_vertex);
+					}
+					cur_tentative = cur_distance;
+					dir.predecessors[index(cur_vertex)] = v;
+					dir.queue.emplace(cur_distance, cur_vertex);
+
+					if (const TWeight opposite_distance{ opposite.distances[index(cur_vertex)] }; opposite_distance != infinity
+						&& cur_distance + opposite_distance < m_Best)
+					{
+						m_Best = cur_distance + opposite_distance;
+						m_Meeting = cur_vertex;
+					}
+				}
+			}
+		}
+
+		[[nodiscard]]
+		TVertex middle_of(const TVertex& from, const TVertex& to) const noexcept
+		{
+			const hierarchy_t& hierarchy = *m_Hierarchy;
+			const bool isUpward{ hierarchy.ranks[index(from)] < hierarchy.ranks[index(to)] };
+			const auto& graph = isUpward ? hierarchy.upward : hierarchy.downward;
+			const auto& middles = isUpward ? hierarchy.upwardMiddles : hierarchy.downwardMiddles;
+			const TVertex& owner = isUpward ? from : to;
+			const TVertex& other = isUpward ? to : from;
+
+			const auto neighbors = graph.neighbors(owner);
+			const auto itr = std::ranges::find(neighbors, other);
+			assert(itr != std::end(neighbors) && "edge does not exist.");
+			return middles[graph.offsets[index(owner)] + static_cast<std::size_t>(std::distance(std::begin(neighbors), itr))];
+		}
+
+		// appends all vertices of the unpacked edge, except from
+		void unpack(const TVertex& from, const TVertex& to, std::vector<TVertex>& path) const
+		{
+			std::vector<std::tuple<TVertex, TVertex>> pending{ { from, to } };
+			while (!std::empty(pending))
+			{
+				const auto [cur_from, cur_to] = pending.back();
+				pending.pop_back();
+				if (const TVertex middle{ middle_of(cur_from, cur_to) }; middle != hierarchy_t::no_middle)
+				{
+					pending.emplace_back(middle, cur_to);
+					pending.emplace_back(cur_from, middle);
+				}
+				else
+				{
+					path.emplace_back(cur_to);
+				}
+			}
+		}
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TVertex, class TWeight>
+	struct ch_edge_t
+	{
+		TVertex vertex{};
+		TWeight weight{};
+		TVertex middle{};
+	};
+
+	template <class TVertex, class TWeight>
+	struct ch_shortcut_t
+	{
+		TVertex from{};
+		TVertex to{};
+		TWeight weight{};
+	};
+
+	template <class TVertex, class TWeight>
+	void insert_or_improve_edge(std::vector<ch_edge_t<TVertex, TWeight>>& edges, const ch_edge_t<TVertex, TWeight>& edge)
+	{
+		if (const auto itr = std::ranges::find(edges, edge.vertex, &ch_edge_t<TVertex, TWeight>::vertex); itr != std::end(edges))
+		{
+			if (edge.weight < itr->weight)
+			{
+				*itr = edge;
+			}
+		}
+		else
+		{
+			edges.emplace_back(edge);
+		}
+	}
+
+	template <class TVertex, class TWeight>
+	void erase_edge(std::vector<ch_edge_t<TVertex, TWeight>>& edges, const TVertex& v)
+	{
+		const auto itr = std::ranges::find(edges, v, &ch_edge_t<TVertex, TWeight>::vertex);
+		assert(itr != std::end(edges));
+		*itr = edges.back();
+		edges.pop_back();
+	}
+
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	std::tuple<csr_graph<TVertex, TWeight>, std::vector<TVertex>> make_ch_csr(const std::vector<std::vector<ch_edge_t<TVertex, TWeight>>>& edges)
+	{
+		csr_graph<TVertex, TWeight> graph{};
+		std::vector<TVertex> middles{};
+		graph.offsets.reserve(std::size(edges) + 1);
+		for (const auto& curEdges : edges)
+		{
+			for (const auto& edge : curEdges)
+			{
+				graph.targets.emplace_back(edge.vertex);
+				graph.weights.emplace_back(edge.weight);
+				middles.emplace_back(edge.middle);
+			}
+			graph.offsets.emplace_back(std::size(graph.targets));
+		}
+		return { std::move(graph), std::move(middles) };
+	}
+
+	template <class TVertex, class TWeight>
+	class ch_witness_search
+	{
+	public:
+		static constexpr TWeight infinity{ std::numeric_limits<TWeight>::max() };
+
+		explicit ch_witness_search(std::size_t vertexCount)
+			: m_Distances(vertexCount, infinity)
+		{
+		}
+
+		// bounded dijkstra, which never enters excluded vertices
+		void run
+		(
+			const std::vector<std::vector<ch_edge_t<TVertex, TWeight>>>& outEdges,
+			const TVertex& source,
+			const TWeight& bound,
+			std::size_t settleLimit,
+			const auto& isExcluded
+		)
+		{
+			for (const TVertex& v : m_Touched)
+			{
+				m_Distances[static_cast<std::size_t>(v)] = infinity;
+			}
+			m_Touched.clear();
+			m_Queue = {};
+
+			m_Distances[static_cast<std::size_t>(source)] = TWeight{};
+			m_Touched.emplace_back(source);
+			m_Queue.emplace(TWeight{}, source);
+			for (std::size_t settled{ 0 }; !std::empty(m_Queue) && settled < settleLimit; ++settled)
+			{
+				const auto [distance, v] = m_Queue.top();
+				m_Queue.pop();
+				if (m_Distances[static_cast<std::size_t>(v)] < distance)
+					continue;
+				if (bound < distance)
+					return;
+
+				for (const auto& edge : outEdges[static_cast<std::size_t>(v)])
+				{
+					const TWeight cur_distance{ distance + edge.weight };
+					TWeight& cur_tentative = m_Distances[static_cast<std::size_t>(edge.vertex)];
+					if (cur_distance < cur_tentative && !(bound < cur_distance) && !isExcluded(edge.vertex))
+					{
+						if (cur_tentative == infinity)
+						{
+							m_Touched.emplace_back(edge.vertex);
+						}
+						cur_tentative = cur_distance;
+						m_Queue.emplace(cur_distance, edge.vertex);
+					}
+				}
+			}
+		}
+
+		// tentative distances are upper bounds of the actual distances, thus they are valid witnesses even after an aborted search
+		[[nodiscard]]
+		const TWeight& distance(const TVertex& v) const noexcept
+		{
+			return m_Distances[static_cast<std::size_t>(v)];
+		}
+
+	private:
+		std::vector<TWeight> m_Distances;
+		std::vector<TVertex> m_Touched{};
+		std::priority_queue<std::tuple<TWeight, TVertex>, std::vector<std::tuple<TWeight, TVertex>>, std::greater<>> m_Queue{};
+	};
+
+	template <class TVertex, class TWeight>
+	class ch_builder
+	{
+	public:
+		using edge_t = ch_edge_t<TVertex, TWeight>;
+		using shortcut_t = ch_shortcut_t<TVertex, TWeight>;
+		using hierarchy_t = ch::hierarchy_t<TVertex, TWeight>;
+		using priority_t = std::int64_t;
+
+		ch_builder(const csr_graph<TVertex, TWeight>& graph, std::size_t threadCount, std::size_t settleLimit)
+			: m_ThreadCount{ threadCount },
+			m_SettleLimit{ settleLimit },
+			m_OutEdges(graph.vertex_count()),
+			m_InEdges(graph.vertex_count()),
+			m_Priorities(graph.vertex_count()),
+			m_ContractedNeighbors(graph.vertex_count()),
+			m_Flags(graph.vertex_count())
+		{
+			for (std::size_t i{ 0 }; i < graph.vertex_count(); ++i)
+			{
+				const auto v{ static_cast<TVertex>(i) };
+				const auto neighbors = graph.neighbors(v);
+				const auto weights = graph.neighbor_weights(v);
+				for (std::size_t edge{ 0 }; edge < std::size(neighbors); ++edge)
+				{
+					assert(!(weights[edge] < TWeight{}) && "weights must be greater or equal to zero.");
+					if (neighbors[edge] != v)
+					{
+						insert_or_improve_edge(m_OutEdges[i], edge_t{ neighbors[edge], weights[edge], hierarchy_t::no_middle });
+						insert_or_improve_edge(m_InEdges[index(neighbors[edge])], edge_t{ v, weights[edge], hierarchy_t::no_middle });
+					}
+				}
+			}
+
+			m_Workspaces.reserve(m_ThreadCount);
+			for (std::size_t i{ 0 }; i < m_ThreadCount; ++i)
+			{
+				m_Workspaces.emplace_back(graph.vertex_count());
+			}
+		}
+
+		[[nodiscard]]
+		hierarchy_t run()
+		{
+			const std::size_t vertexCount{ std::size(m_OutEdges) };
+
+			std::vector<TVertex> remaining(vertexCount);
+			for (std::size_t i{ 0 }; i < vertexCount; ++i)
+			{
+				remaining[i] = static_cast<TVertex>(i);
+			}
+			update_priorities(remaining);
+
+			hierarchy_t hierarchy{ .ranks = std::vector<std::size_t>(vertexCount) };
+			std::vector<std::vector<edge_t>> upwardEdges(vertexCount);
+			std::vector<std::vector<edge_t>> downwardEdges(vertexCount);
+			std::vector<TVertex> batch{};
+			std::vector<TVertex> affected{};
+			std::vector<std::vector<shortcut_t>> shortcuts{};
+			for (std::size_t rank{ 0 }; !std::empty(remaining);)
+			{
+				select_independent_set(remaining, batch);
+				std::erase_if(remaining, [&](const TVertex& v) { return m_Flags[index(v)] == flag_selected; });
+
+				shortcuts.resize(std::size(batch));
+				parallel_for
+				(
+					m_ThreadCount,
+					std::size(batch),
+					[&](const std::size_t threadIndex, const std::size_t i)
+					{
+						shortcuts[i].clear();
+						collect_shortcuts(batch[i], m_Workspaces[threadIndex], shortcuts[i]);
+					}
+				);
+
+				affected.clear();
+				for (std::size_t i{ 0 }; i < std::size(batch); ++i)
+				{
+					const TVertex& v = batch[i];
+					hierarchy.ranks[index(v)] = rank++;
+					contract(v, shortcuts[i], affected);
+					upwardEdges[index(v)] = std::exchange(m_OutEdges[index(v)], {});
+					downwardEdges[index(v)] = std::exchange(m_InEdges[index(v)], {});
+					m_Flags[index(v)] = flag_contracted;
+				}
+
+				for (const TVertex& v : affected)
+				{
+					m_Flags[index(v)] = flag_none;
+				}
+				update_priorities(affected);
+			}
+
+			std::tie(hierarchy.upward, hierarchy.upwardMiddles) = make_ch_csr(upwardEdges);
+			std::tie(hierarchy.downward, hierarchy.downwardMiddles) = make_ch_csr(downwardEdges);
+			return hierarchy;
+		}
+
+	private:
+		enum flag_t : std::uint8_t
+		{
+			flag_none,
+			flag_selected,
+			flag_affected,
+			flag_contracted
+		};
+
+		std::size_t m_ThreadCount;
+		std::size_t m_SettleLimit;
+		std::vector<std::vector<edge_t>> m_OutEdges;
+		std::vector<std::vector<edge_t>> m_InEdges;
+		std::vector<priority_t> m_Priorities;
+		std::vector<priority_t> m_ContractedNeighbors;
+		std::vector<flag_t> m_Flags;
+		std::vector<ch_witness_search<TVertex, TWeight>> m_Workspaces{};
+
+		[[nodiscard]]
+		static constexpr std::size_t index(const TVertex& v) noexcept
+		{
+			return static_cast<std::size_t>(v);
+		}
+
+		void collect_shortcuts(const TVertex& v, ch_witness_search<TVertex, TWeight>& workspace, std::vector<shortcut_t>& shortcuts) const
+		{
+			// vertices, which are contracted in the same batch, must not be used as witnesses
+			const auto isExcluded = [&](const TVertex& x) { return x == v || m_Flags[index(x)] == flag_selected; };
+
+			const std::vector<edge_t>& outEdges = m_OutEdges[index(v)];
+			for (const edge_t& inEdge : m_InEdges[index(v)])
+			{
+				std::optional<TWeight> maxOutWeight{};
+				for (const edge_t& outEdge : outEdges)
+				{
+					if (outEdge.vertex != inEdge.vertex && (!maxOutWeight || *maxOutWeight < outEdge.weight))
+					{
+						maxOutWeight = outEdge.weight;
+					}
+				}
+				if (!maxOutWeight)
+					continue;
+
+				workspace.run(m_OutEdges, inEdge.vertex, inEdge.weight + *maxOutWeight, m_SettleLimit, isExcluded);
+				for (const edge_t& outEdge : outEdges)
+				{
+					const TWeight via{ inEdge.weight + outEdge.weight };
+					if (outEdge.vertex != inEdge.vertex && via < workspace.distance(outEdge.vertex))
+					{
+						shortcuts.emplace_back(shortcut_t{ inEdge.vertex, outEdge.vertex, via });
+					}
+				}
+			}
+		}
+
+		void update_priorities(const std::vector<TVertex>& vertices)
+		{
+			std::vector<std::vector<shortcut_t>> shortcuts(m_ThreadCount);
+			parallel_for
+			(
+				m_ThreadCount,
+				std::size(vertices),
+				[&](const std::size_t threadIndex, const std::size_t i)
+				{
+					const TVertex& v = vertices[i];
+					shortcuts[threadIndex].clear();
+					collect_shortcuts(v, m_Workspaces[threadIndex], shortcuts[threadIndex]);
+
+					// edge difference, with an additional penalty for vertices in already contracted regions
+					m_Priorities[index(v)] = 2 * static_cast<priority_t>(std::size(shortcuts[threadIndex]))
+											- static_cast<priority_t>(std::size(m_OutEdges[index(v)]) + std::size(m_InEdges[index(v)]))
+											+ m_ContractedNeighbors[index(v)];
+				}
+			);
+		}
+
+		void select_independent_set(const std::vector<TVertex>& remaining, std::vector<TVertex>& batch)
+		{
+			const auto key = [&](const TVertex& v) { return std::tuple{ m_Priorities[index(v)], v }; };
+
+			// a vertex is selected, if its key is less than the keys of all its remaining neighbors
+			std::vector<char> selected(std::size(remaining));
+			parallel_for
+			(
+				m_ThreadCount,
+				std::size(remaining),
+				[&](const std::size_t i)
+				{
+					const TVertex& v = remaining[i];
+					const auto isLess = [&](const edge_t& edge) { return key(v) < key(edge.vertex); };
+					selected[i] = std::ranges::all_of(m_OutEdges[index(v)], isLess)
+								&& std::ranges::all_of(m_InEdges[index(v)], isLess);
+				}
+			);
+
+			batch.clear();
+			for (std::size_t i{ 0 }; i < std::size(remaining); ++i)
+			{
+				if (selected[i])
+				{
+					batch.emplace_back(remaining[i]);
+					m_Flags[index(remaining[i])] = flag_selected;
+				}
+			}
+			assert(!std::empty(batch));
+		}
+
+		void contract(const TVertex& v, const std::vector<shortcut_t>& shortcuts, std::vector<TVertex>& affected)
+		{
+			const auto markAffected = [&](const TVertex& x)
+			{
+				++m_ContractedNeighbors[index(x)];
+				if (m_Flags[index(x)] == flag_none)
+				{
+					m_Flags[index(x)] = flag_affected;
+					affected.emplace_back(x);
+				}
+			};
+
+			for (const edge_t& edge : m_InEdges[index(v)])
+			{
+				erase_edge(m_OutEdges[index(edge.vertex)], v);
+				markAffected(edge.vertex);
+			}
+
+			for (const edge_t& edge : m_OutEdges[index(v)])
+			{
+				erase_edge(m_InEdges[index(edge.vertex)], v);
+				markAffected(edge.vertex);
+			}
+
+			for (const shortcut_t& shortcut : shortcuts)
+			{
+				insert_or_improve_edge(m_OutEdges[index(shortcut.from)], edge_t{ shortcut.to, shortcut.weight, v });
+				insert_or_improve_edge(m_InEdges[index(shortcut.to)], edge_t{ shortcut.from, shortcut.weight, v });
+			}
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Contracts the graph of the given params.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \param params The build_params object.
+	 * \return Returns the created hierarchy.
+	 * \ingroup contraction_hierarchy
+	 */
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	ch::hierarchy_t<TVertex, TWeight> build_hierarchy(const ch::build_params<TVertex, TWeight>& params)
+	{
+		detail::ch_builder<TVertex, TWeight> builder
+		{
+			params.graph,
+			detail::resolve_thread_count(params.threadCount),
+			params.witnessSettleLimit
+		};
+		return builder.run();
+	}
+
+	/**
+	 * \brief Searches for the shortest path between both vertices.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \param hierarchy The hierarchy to be queried.
+	 * \param begin The begin vertex.
+	 * \param destination The destination vertex.
+	 * \return Returns the path in reversed order (destination first), or ``std::nullopt`` if destination is unreachable.
+	 * \remark Use a ``ch::query_t`` object for repeated queries, to reuse its buffers.
+	 * \ingroup contraction_hierarchy
+	 */
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	std::optional<std::vector<TVertex>> find_path
+	(
+		const ch::hierarchy_t<TVertex, TWeight>& hierarchy,
+		const std::type_identity_t<TVertex>& begin,
+		const std::type_identity_t<TVertex>& destination
+	)
+	{
+		return ch::query_t<TVertex, TWeight>{ hierarchy }.find_path(begin, destination);
+	}
+}
+
+#endif
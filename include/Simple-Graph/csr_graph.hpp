@@ -0,0 +1,252 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_CSR_GRAPH_HPP
+#define SIMPLE_GRAPH_CSR_GRAPH_HPP
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace sl::graph
+{
+	/** \addtogroup csr_graph
+	* @{
+	* \brief Provides a static graph representation in the compressed-sparse-row format.
+	* \details The out-edges of each vertex are stored contiguously, which makes scanning the neighbors of a vertex a linear memory
+	* access. The graph operates on dense vertex ids, thus each vertex must be an integral value in the range ``[0, vertex_count())``.
+	*/
+
+	/**
+	 * \brief Static graph in the compressed-sparse-row format.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	struct csr_graph
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief The edge range of each vertex. The out-edges of vertex v are stored at ``[offsets[v], offsets[v + 1])``.
+		 */
+		std::vector<std::size_t> offsets{ 0 };
+
+		/**
+		 * \brief The target vertex of each edge.
+		 */
+		std::vector<TVertex> targets{};
+
+		/**
+		 * \brief The weight of each edge.
+		 */
+		std::vector<TWeight> weights{};
+
+		/**
+		 * \brief Returns the amount of vertices.
+		 */
+		[[nodiscard]]
+		std::size_t vertex_count() const noexcept
+		{
+			return std::size(offsets) - 1;
+		}
+
+		/**
+		 * \brief Returns the amount of edges.
+		 */
+		[[nodiscard]]
+		std::size_t edge_count() const noexcept
+		{
+			return std::size(targets);
+		}
+
+		/**
+		 * \brief Returns the targets of all out-edges of the given vertex.
+		 */
+		[[nodiscard]]
+		std::span<const TVertex> neighbors(const TVertex& v) const noexcept
+		{
+			const auto index{ static_cast<std::size_t>(v) };
+			assert(index < vertex_count() && "vertex is out of range.");
+			return { std::data(targets) + offsets[index], offsets[index + 1] - offsets[index] };
+		}
+
+		/**
+		 * \brief Returns the weights of all out-edges of the given vertex.
+		 */
+		[[nodiscard]]
+		std::span<const TWeight> neighbor_weights(const TVertex& v) const noexcept
+		{
+			const auto index{ static_cast<std::size_t>(v) };
+			assert(index < vertex_count() && "vertex is out of range.");
+			return { std::data(weights) + offsets[index], offsets[index + 1] - offsets[index] };
+		}
+
+		/**
+		 * \brief Returns the least weight of all edges from ``from`` to ``to``, if any.
+		 */
+		[[nodiscard]]
+		std::optional<TWeight> edge_weight(const TVertex& from, const TVertex& to) const noexcept
+		{
+			std::optional<TWeight> result{};
+			const std::span<const TVertex> curNeighbors{ neighbors(from) };
+			const std::span<const TWeight> curWeights{ neighbor_weights(from) };
+			for (std::size_t i{ 0 }; i < std::size(curNeighbors); ++i)
+			{
+				if (curNeighbors[i] == to && (!result || curWeights[i] < *result))
+				{
+					result = curWeights[i];
+				}
+			}
+			return result;
+		}
+	};
+
+	/**
+	 * \brief Neighbor searcher, which returns the out-neighbors of a vertex in a csr_graph.
+	 * \tparam TGraph The graph type.
+	 */
+	template <class TGraph>
+	struct csr_neighbor_searcher
+	{
+		const TGraph* graph{};
+
+		[[nodiscard]]
+		auto operator ()(const typename TGraph::vertex_t& v) const noexcept
+		{
+			assert(graph);
+			return graph->neighbors(v);
+		}
+	};
+
+	/**
+	 * \brief Weight calculator, which returns the weight of an edge in a csr_graph.
+	 * \tparam TGraph The graph type.
+	 * \attention The edge must exist.
+	 */
+	template <class TGraph>
+	struct csr_weight_calculator
+	{
+		const TGraph* graph{};
+
+		[[nodiscard]]
+		typename TGraph::weight_t operator ()(const typename TGraph::vertex_t& from, const typename TGraph::vertex_t& to) const noexcept
+		{
+			assert(graph);
+			const std::optional weight{ graph->edge_weight(from, to) };
+			assert(weight && "edge does not exist.");
+			return *weight;
+		}
+	};
+
+	/**
+	 * \brief Creates a csr_graph from the given neighbor searcher and weight calculator.
+	 * \tparam TVertex The vertex type. Must explicitly defined.
+	 * \param vertexCount The total amount of vertices. Each vertex must be in the range ``[0, vertexCount)``.
+	 * \param neighborSearcher The neighbor searcher to be used.
+	 * \param weightCalculator The weight calculator to be used.
+	 * \return Returns the newly created graph.
+	 */
+	template <std::integral TVertex>
+	[[nodiscard]]
+	auto make_csr_graph
+	(
+		std::size_t vertexCount,
+		neighbor_searcher_for<TVertex> auto&& neighborSearcher,
+		weight_calculator_for<TVertex> auto&& weightCalculator
+	)
+	{
+		using weight_t = detail::weight_type_of_t<decltype(weightCalculator), TVertex>;
+
+		csr_graph<TVertex, weight_t> graph{};
+		graph.offsets.reserve(vertexCount + 1);
+		for (std::size_t i{ 0 }; i < vertexCount; ++i)
+		{
+			const auto v{ static_cast<TVertex>(i) };
+			for (const TVertex& cur_vertex : std::invoke(neighborSearcher, v))
+			{
+				assert(static_cast<std::size_t>(cur_vertex) < vertexCount && "vertex is out of range.");
+				graph.targets.emplace_back(cur_vertex);
+				graph.weights.emplace_back(std::invoke(weightCalculator, v, cur_vertex));
+			}
+			graph.offsets.emplace_back(std::size(graph.targets));
+		}
+		return graph;
+	}
+
+	/**
+	 * \brief Creates the transposed graph, where each edge points into the opposite direction.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \param graph The source graph.
+	 * \return Returns the newly created graph.
+	 */
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	csr_graph<TVertex, TWeight> transpose(const csr_graph<TVertex, TWeight>& graph)
+	{
+		const std::size_t vertexCount{ graph.vertex_count() };
+
+		csr_graph<TVertex, TWeight> result{};
+		result.offsets.assign(vertexCount + 1, 0);
+		for (const TVertex& target : graph.targets)
+		{
+			++result.offsets[static_cast<std::size_t>(target) + 1];
+		}
+		std::partial_sum(std::begin(result.offsets), std::end(result.offsets), std::begin(result.offsets));
+
+		result.targets.resize(graph.edge_count());
+		result.weights.resize(graph.edge_count());
+		std::vector<std::size_t> insertPositions(std::begin(result.offsets), std::end(result.offsets) - 1);
+		for (std::size_t i{ 0 }; i < vertexCount; ++i)
+		{
+			for (std::size_t edge{ graph.offsets[i] }; edge < graph.offsets[i + 1]; ++edge)
+			{
+				const std::size_t pos{ insertPositions[static_cast<std::size_t>(graph.targets[edge])]++ };
+				result.targets[pos] = static_cast<TVertex>(i);
+				result.weights[pos] = graph.weights[edge];
+			}
+		}
+		return result;
+	}
+
+	/** @}*/
+}
+
+/**
+ * \brief Specialization for csr_neighbor_searcher, which prefetches the out-edges of the given vertex.
+ * \tparam TGraph The graph type.
+ */
+template <class TGraph>
+struct sl::graph::prefetch_t<sl::graph::csr_neighbor_searcher<TGraph>>
+{
+	void operator ()(const csr_neighbor_searcher<TGraph>& neighborSearcher, const typename TGraph::vertex_t& v) const noexcept
+	{
+		assert(neighborSearcher.graph);
+		const TGraph& graph{ *neighborSearcher.graph };
+		const std::size_t firstEdge{ graph.offsets[static_cast<std::size_t>(v)] };
+		prefetch(graph.targets, firstEdge);
+		prefetch(graph.weights, firstEdge);
+	}
+};
+
+#endif
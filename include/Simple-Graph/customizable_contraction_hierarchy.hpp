@@ -0,0 +1,657 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_CUSTOMIZABLE_CONTRACTION_HIERARCHY_HPP
+#define SIMPLE_GRAPH_CUSTOMIZABLE_CONTRACTION_HIERARCHY_HPP
+
+#pragma once
+
+#include "contraction_hierarchy.hpp"
+#include "csr_graph.hpp"
+#include "parallel_helper.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::cch
+{
+	/** \addtogroup customizable_contraction_hierarchy
+	* @{
+	* \brief Provides customizable contraction hierarchies, which separate the metric independent preprocessing from the
+	* (frequently repeated) application of the actual edge weights.
+	* \details The preprocessing computes a nested dissection order of the graph and contracts all vertices in that order without
+	* any witness searches. The resulting topology contains every possible shortcut and solely depends on the graph structure.
+	* The customization applies a weight calculator to that topology, by enumerating the lower triangles of all edges. Vertices
+	* of the same level (i.e. vertices, which don't depend on each other) are customized in parallel.
+	* The customization yields an ordinary ``ch::hierarchy_t``, thus it's queried exactly like the static contraction hierarchy.
+	* Customizable contraction hierarchies operate on graphs with dense vertex ids, thus each vertex must be an integral value in
+	* the range ``[0, vertexCount)``.
+	*/
+
+	/**
+	 * \brief The metric independent result of the preprocessing.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	class topology_t
+	{
+	public:
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the customization result type.
+		 */
+		using hierarchy_t = ch::hierarchy_t<TVertex, TWeight>;
+
+		/**
+		 * \brief Constructor, which executes the preprocessing.
+		 * \param graph The graph. Only its structure is used, the weights are ignored.
+		 */
+		explicit topology_t(const csr_graph<TVertex, TWeight>& graph)
+		{
+			const std::size_t vertexCount{ graph.vertex_count() };
+			const std::vector<std::vector<TVertex>> neighbors{ make_undirected_neighbors(graph) };
+
+			m_Order = make_nested_dissection_order(neighbors);
+			m_Ranks.resize(vertexCount);
+			for (std::size_t rank{ 0 }; rank < vertexCount; ++rank)
+			{
+				m_Ranks[index(m_Order[rank])] = rank;
+			}
+
+			make_chordal_edges(neighbors);
+			make_lower_edges();
+			make_levels();
+
+			for (std::size_t i{ 0 }; i < vertexCount; ++i)
+			{
+				for (const TVertex& cur_vertex : graph.neighbors(static_cast<TVertex>(i)))
+				{
+					const std::size_t from{ m_Ranks[i] };
+					const std::size_t to{ m_Ranks[index(cur_vertex)] };
+					const bool isUpward{ from < to };
+					m_OriginalEdges.emplace_back
+					(
+						original_edge_t
+						{
+							.from = static_cast<TVertex>(i),
+							.to = cur_vertex,
+							.edge = from == to ? no_edge : find_edge(std::min(from, to), std::max(from, to)),
+							.isUpward = isUpward
+						}
+					);
+				}
+			}
+		}
+
+		/**
+		 * \brief Returns the amount of vertices.
+		 */
+		[[nodiscard]]
+		std::size_t vertex_count() const noexcept
+		{
+			return std::size(m_Order);
+		}
+
+		/**
+		 * \brief Returns the amount of (undirected) edges, including all shortcuts.
+		 */
+		[[nodiscard]]
+		std::size_t edge_count() const noexcept
+		{
+			return std::size(m_UpwardTargets);
+		}
+
+		/**
+		 * \brief Applies the weights of the given weight calculator.
+		 * \param weightCalculator The weight calculator to be used. It's invoked once for each edge of the original graph.
+		 * \param threadCount The amount of threads to be used. If set to 0, ``std::thread::hardware_concurrency`` is used.
+		 * \return Returns the customized hierarchy.
+		 */
+		template <weight_calculator_for<TVertex> TWeightCalculator>
+		[[nodiscard]]
+		hierarchy_t customize(TWeightCalculator& weightCalculator, std::size_t threadCount) const
+		{
+			threadCount = detail::resolve_thread_count(threadCount);
+
+			std::vector<TWeight> originalWeights(std::size(m_OriginalEdges));
+			detail::parallel_for
+			(
+				threadCount,
+				std::size(m_OriginalEdges),
+				[&](const std::size_t i)
+				{
+					originalWeights[i] = static_cast<TWeight>(std::invoke(weightCalculator, m_OriginalEdges[i].from, m_OriginalEdges[i].to));
+					assert(!(originalWeights[i] < TWeight{}) && "weights must be greater or equal to zero.");
+				}
+			);
+
+			std::vector<TWeight> upWeights(edge_count(), infinity);
+			std::vector<TWeight> downWeights(edge_count(), infinity);
+			std::vector<std::size_t> upMiddles(edge_count(), no_edge);
+			std::vector<std::size_t> downMiddles(edge_count(), no_edge);
+			for (std::size_t i{ 0 }; i < std::size(m_OriginalEdges); ++i)
+			{
+				if (const original_edge_t& edge = m_OriginalEdges[i]; edge.edge != no_edge)
+				{
+					TWeight& cur_weight = edge.isUpward ? upWeights[edge.edge] : downWeights[edge.edge];
+					cur_weight = std::min(cur_weight, originalWeights[i]);
+				}
+			}
+
+			// each vertex pulls the lower triangles into its upward edges; all lower vertices belong to lower levels
+			std::vector<std::vector<std::size_t>> scratches(threadCount, std::vector<std::size_t>(vertex_count(), no_edge));
+			for (std::size_t level{ 1 }; level + 1 < std::size(m_LevelOffsets); ++level)
+			{
+				detail::parallel_for
+				(
+					threadCount,
+					m_LevelOffsets[level + 1] - m_LevelOffsets[level],
+					[&](const std::size_t threadIndex, const std::size_t i)
+					{
+						customize_vertex(m_LevelVertices[m_LevelOffsets[level] + i], scratches[threadIndex], upWeights, downWeights, upMiddles, downMiddles);
+					}
+				);
+			}
+
+			return make_hierarchy(upWeights, downWeights, upMiddles, downMiddles);
+		}
+
+	private:
+		static constexpr std::size_t no_edge{ std::numeric_limits<std::size_t>::max() };
+		static constexpr TWeight infinity{ std::numeric_limits<TWeight>::max() };
+
+		struct original_edge_t
+		{
+			TVertex from{};
+			TVertex to{};
+			std::size_t edge{};
+			bool isUpward{};
+		};
+
+		// vertices of each rank
+		std::vector<TVertex> m_Order{};
+		std::vector<std::size_t> m_Ranks{};
+
+		// all edges (x, y) with x < y (in rank space), stored at x and sorted by y
+		std::vector<std::size_t> m_UpwardOffsets{};
+		std::vector<std::size_t> m_UpwardTargets{};
+
+		// the edge ids of all edges (x, y) with x < y, stored at y
+		std::vector<std::size_t> m_LowerOffsets{};
+		std::vector<std::size_t> m_LowerEdges{};
+		std::vector<std::size_t> m_LowerSources{};
+
+		// vertices (in rank space), grouped by their level
+		std::vector<std::size_t> m_LevelOffsets{};
+		std::vector<std::size_t> m_LevelVertices{};
+
+		std::vector<original_edge_t> m_OriginalEdges{};
+
+		[[nodiscard]]
+		static constexpr std::size_t index(const TVertex& v) noexcept
+		{
+			return static_cast<std::size_t>(v);
+		}
+
+		[[nodiscard]]
+		static std::vector<std::vector<TVertex>> make_undirected_neighbors(const csr_graph<TVertex, TWeight>& graph)
+		{
+			std::vector<std::vector<TVertex>> neighbors(graph.vertex_count());
+			for (std::size_t i{ 0 }; i < graph.vertex_count(); ++i)
+			{
+				for (const TVertex& cur_vertex : graph.neighbors(static_cast<TVertex>(i)))
+				{
+					assert(index(cur_vertex) < graph.vertex_count() && "vertex is out of range.");
+					if (index(cur_vertex) != i)
+					{
+						neighbors[i].emplace_back(cur_vertex);
+						neighbors[index(cur_vertex)].emplace_back(static_cast<TVertex>(i));
+					}
+				}
+			}
+
+			for (auto& curNeighbors : neighbors)
+			{
+				std::ranges::sort(curNeighbors);
+				const auto [first, last] = std::ranges::unique(curNeighbors);
+				curNeighbors.erase(first, last);
+			}
+			return neighbors;
+		}
+
+		// recursively bisects the graph along breadth first search levels; the separators are ordered after both halves
+		[[nodiscard]]
+		static std::vector<TVertex> make_nested_dissection_order(const std::vector<std::vector<TVertex>>& neighbors)
+		{
+			struct task_t
+			{
+				std::vector<TVertex> vertices{};
+				bool isSeparator{};
+			};
+
+			const std::size_t vertexCount{ std::size(neighbors) };
+			std::vector<TVertex> order{};
+			order.reserve(vertexCount);
+
+			std::vector<std::size_t> stamps(vertexCount);
+			std::vector<std::size_t> levels(vertexCount);
+			std::vector<TVertex> queue{};
+			std::size_t curStamp{ 0 };
+
+			// collects all reached vertices of the current sub-graph in breadth first order
+			const auto bfs = [&](const TVertex& begin, const std::size_t stamp)
+			{
+				queue.clear();
+				queue.emplace_back(begin);
+				stamps[index(begin)] = stamp + 1;
+				levels[index(begin)] = 0;
+				for (std::size_t i{ 0 }; i < std::size(queue); ++i)
+				{
+					const TVertex v{ queue[i] };
+					for (const TVertex& cur_vertex : neighbors[index(v)])
+					{
+						if (stamps[index(cur_vertex)] == stamp)
+						{
+							stamps[index(cur_vertex)] = stamp + 1;
+							levels[index(cur_vertex)] = levels[index(v)] + 1;
+							queue.emplace_back(cur_vertex);
+						}
+					}
+				}
+			};
+
+			std::vector<task_t> tasks{};
+			tasks.emplace_back(task_t{ std::vector<TVertex>(vertexCount), false });
+			for (std::size_t i{ 0 }; i < vertexCount; ++i)
+			{
+				tasks.back().vertices[i] = static_cast<TVertex>(i);
+			}
+
+			while (!std::empty(tasks))
+			{
+				task_t task{ std::move(tasks.back()) };
+				tasks.pop_back();
+
+				if (task.isSeparator || std::size(task.vertices) <= 2)
+				{
+					order.insert(std::end(order), std::begin(task.vertices), std::end(task.vertices));
+					continue;
+				}
+
+				// mark the members of the current sub-graph; each bfs sweep increments the stamp
+				curStamp += 3;
+				for (const TVertex& v : task.vertices)
+				{
+					stamps[index(v)] = curStamp;
+				}
+
+				// the last vertex of a bfs is a good approximation of a peripheral vertex
+				bfs(task.vertices.front(), curStamp);
+				const TVertex peripheral{ queue.back() };
+				const std::size_t componentSize{ std::size(queue) };
+				bfs(peripheral, curStamp + 1);
+
+				if (componentSize < std::size(task.vertices))
+				{
+					// disconnected components don't need any separator
+					std::erase_if(task.vertices, [&](const TVertex& v) { return stamps[index(v)] != curStamp; });
+					tasks.emplace_back(std::move(task));
+					tasks.emplace_back(task_t{ queue, false });
+					continue;
+				}
+
+				// the level of the median vertex becomes the separator
+				std::size_t separatorLevel{ 0 };
+				for (std::size_t i{ 0 }; i < std::size(queue); ++i)
+				{
+					if (std::size(queue) <= 2 * i)
+					{
+						separatorLevel = std::max<std::size_t>(levels[index(queue[i])], 1);
+						break;
+					}
+				}
+
+				task_t lower{}, upper{}, separator{ .isSeparator = true };
+				for (const TVertex& v : queue)
+				{
+					const std::size_t level{ levels[index(v)] };
+					(level < separatorLevel ? lower : separatorLevel < level ? upper : separator).vertices.emplace_back(v);
+				}
+
+				tasks.emplace_back(std::move(separator));
+				if (!std::empty(upper.vertices))
+					tasks.emplace_back(std::move(upper));
+				tasks.emplace_back(std::move(lower));
+			}
+
+			assert(std::size(order) == vertexCount);
+			return order;
+		}
+
+		// contracts all vertices in rank order, which yields the upward edges of the chordal super-graph
+		void make_chordal_edges(const std::vector<std::vector<TVertex>>& neighbors)
+		{
+			const std::size_t vertexCount{ vertex_count() };
+			std::vector<std::vector<std::size_t>> upperNeighbors(vertexCount);
+			for (std::size_t rank{ 0 }; rank < vertexCount; ++rank)
+			{
+				for (const TVertex& cur_vertex : neighbors[index(m_Order[rank])])
+				{
+					if (const std::size_t cur_rank{ m_Ranks[index(cur_vertex)] }; rank < cur_rank)
+					{
+						upperNeighbors[rank].emplace_back(cur_rank);
+					}
+				}
+			}
+
+			m_UpwardOffsets.reserve(vertexCount + 1);
+			m_UpwardOffsets.emplace_back(0);
+			for (std::size_t rank{ 0 }; rank < vertexCount; ++rank)
+			{
+				std::vector<std::size_t>& curNeighbors = upperNeighbors[rank];
+				std::ranges::sort(curNeighbors);
+				const auto [first, last] = std::ranges::unique(curNeighbors);
+				curNeighbors.erase(first, last);
+
+				// all upper neighbors form a clique, which is represented by the least of them (the elimination tree parent)
+				if (!std::empty(curNeighbors))
+				{
+					std::vector<std::size_t>& parentNeighbors = upperNeighbors[curNeighbors.front()];
+					parentNeighbors.insert(std::end(parentNeighbors), std::begin(curNeighbors) + 1, std::end(curNeighbors));
+				}
+
+				m_UpwardTargets.insert(std::end(m_UpwardTargets), std::begin(curNeighbors), std::end(curNeighbors));
+				m_UpwardOffsets.emplace_back(std::size(m_UpwardTargets));
+				curNeighbors = {};
+			}
+		}
+
+		void make_lower_edges()
+		{
+			const std::size_t vertexCount{ vertex_count() };
+			m_LowerOffsets.assign(vertexCount + 1, 0);
+			for (const std::size_t target : m_UpwardTargets)
+			{
+				++m_LowerOffsets[target + 1];
+			}
+			std::partial_sum(std::begin(m_LowerOffsets), std::end(m_LowerOffsets), std::begin(m_LowerOffsets));
+
+			m_LowerEdges.resize(edge_count());
+			m_LowerSources.resize(edge_count());
+			std::vector<std::size_t> insertPositions(std::begin(m_LowerOffsets), std::end(m_LowerOffsets) - 1);
+			for (std::size_t rank{ 0 }; rank < vertexCount; ++rank)
+			{
+				for (std::size_t edge{ m_UpwardOffsets[rank] }; edge < m_UpwardOffsets[rank + 1]; ++edge)
+				{
+					const std::size_t pos{ insertPositions[m_UpwardTargets[edge]]++ };
+					m_LowerEdges[pos] = edge;
+					m_LowerSources[pos] = rank;
+				}
+			}
+		}
+
+		// the level of a vertex exceeds the levels of all its lower neighbors, thus vertices of the same level are independent
+		void make_levels()
+		{
+			const std::size_t vertexCount{ vertex_count() };
+			std::vector<std::size_t> levels(vertexCount);
+			std::size_t levelCount{ 0 };
+			for (std::size_t rank{ 0 }; rank < vertexCount; ++rank)
+			{
+				levelCount = std::max(levelCount, levels[rank] + 1);
+				for (std::size_t edge{ m_UpwardOffsets[rank] }; edge < m_UpwardOffsets[rank + 1]; ++edge)
+				{
+					std::size_t& cur_level = levels[m_UpwardTargets[edge]];
+					cur_level = std::max(cur_level, levels[rank] + 1);
+				}
+			}
+
+			m_LevelOffsets.assign(levelCount + 1, 0);
+			for (const std::size_t level : levels)
+			{
+				++m_LevelOffsets[level + 1];
+			}
+			std::partial_sum(std::begin(m_LevelOffsets), std::end(m_LevelOffsets), std::begin(m_LevelOffsets));
+
+			m_LevelVertices.resize(vertexCount);
+			std::vector<std::size_t> insertPositions(std::begin(m_LevelOffsets), std::end(m_LevelOffsets) - 1);
+			for (std::size_t rank{ 0 }; rank < vertexCount; ++rank)
+			{
+				m_LevelVertices[insertPositions[levels[rank]]++] = rank;
+			}
+		}
+
+		[[nodiscard]]
+		std::size_t find_edge(std::size_t from, std::size_t to) const noexcept
+		{
+			const auto first = std::begin(m_UpwardTargets) + static_cast<std::ptrdiff_t>(m_UpwardOffsets[from]);
+			const auto last = std::begin(m_UpwardTargets) + static_cast<std::ptrdiff_t>(m_UpwardOffsets[from + 1]);
+			const auto itr = std::lower_bound(first, last, to);
+			assert(itr != last && *itr == to && "edge does not exist.");
+			return static_cast<std::size_t>(std::distance(std::begin(m_UpwardTargets), itr));
+		}
+
+		void customize_vertex
+		(
+			std::size_t rank,
+			std::vector<std::size_t>& scratch,
+			std::vector<TWeight>& upWeights,
+			std::vector<TWeight>& downWeights,
+			std::vector<std::size_t>& upMiddles,
+			std::vector<std::size_t>& downMiddles
+		) const
+		{
+			for (std::size_t edge{ m_UpwardOffsets[rank] }; edge < m_UpwardOffsets[rank + 1]; ++edge)
+			{
+				scratch[m_UpwardTargets[edge]] = edge;
+			}
+
+			// each lower triangle (x, rank, z) may shorten the edge (rank, z) in both directions
+			for (std::size_t lower{ m_LowerOffsets[rank] }; lower < m_LowerOffsets[rank + 1]; ++lower)
+			{
+				const std::size_t lowerEdge{ m_LowerEdges[lower] };
+				const std::size_t x{ m_LowerSources[lower] };
+				for (std::size_t edge{ lowerEdge + 1 }; edge < m_UpwardOffsets[x + 1]; ++edge)
+				{
+					const std::size_t curEdge{ scratch[m_UpwardTargets[edge]] };
+					assert(curEdge != no_edge && "topology is not chordal.");
+
+					const TWeight& toX{ downWeights[lowerEdge] };
+					const TWeight& fromX{ upWeights[lowerEdge] };
+					if (toX != infinity && upWeights[edge] != infinity && toX + upWeights[edge] < upWeights[curEdge])
+					{
+						upWeights[curEdge] = toX + upWeights[edge];
+						upMiddles[curEdge] = x;
+					}
+					if (fromX != infinity && downWeights[edge] != infinity && downWeights[edge] + fromX < downWeights[curEdge])
+					{
+						downWeights[curEdge] = downWeights[edge] + fromX;
+						downMiddles[curEdge] = x;
+					}
+				}
+			}
+
+			for (std::size_t edge{ m_UpwardOffsets[rank] }; edge < m_UpwardOffsets[rank + 1]; ++edge)
+			{
+				scratch[m_UpwardTargets[edge]] = no_edge;
+			}
+		}
+
+		[[nodiscard]]
+		hierarchy_t make_hierarchy
+		(
+			const std::vector<TWeight>& upWeights,
+			const std::vector<TWeight>& downWeights,
+			const std::vector<std::size_t>& upMiddles,
+			const std::vector<std::size_t>& downMiddles
+		) const
+		{
+			const auto toMiddle = [&](const std::size_t middle) { return middle == no_edge ? hierarchy_t::no_middle : m_Order[middle]; };
+
+			hierarchy_t hierarchy{ .ranks = m_Ranks };
+			hierarchy.upward.offsets.reserve(vertex_count() + 1);
+			hierarchy.downward.offsets.reserve(vertex_count() + 1);
+			for (std::size_t i{ 0 }; i < vertex_count(); ++i)
+			{
+				const std::size_t rank{ m_Ranks[i] };
+				for (std::size_t edge{ m_UpwardOffsets[rank] }; edge < m_UpwardOffsets[rank + 1]; ++edge)
+				{
+					const TVertex target{ m_Order[m_UpwardTargets[edge]] };
+					if (upWeights[edge] != infinity)
+					{
+						hierarchy.upward.targets.emplace_back(target);
+						hierarchy.upward.weights.emplace_back(upWeights[edge]);
+						hierarchy.upwardMiddles.emplace_back(toMiddle(upMiddles[edge]));
+					}
+					if (downWeights[edge] != infinity)
+					{
+						hierarchy.downward.targets.emplace_back(target);
+						hierarchy.downward.weights.emplace_back(downWeights[edge]);
+						hierarchy.downwardMiddles.emplace_back(toMiddle(downMiddles[edge]));
+					}
+				}
+				hierarchy.upward.offsets.emplace_back(std::size(hierarchy.upward.targets));
+				hierarchy.downward.offsets.emplace_back(std::size(hierarchy.downward.targets));
+			}
+			return hierarchy;
+		}
+	};
+
+	/**
+	 * \brief The params of the metric independent preprocessing.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+		requires std::is_arithmetic_v<TWeight>
+	struct build_params
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the result type.
+		 */
+		using topology_t = cch::topology_t<TVertex, TWeight>;
+
+		/**
+		 * \brief The graph. Only its structure is used, the weights are ignored.
+		 */
+		csr_graph<TVertex, TWeight> graph{};
+	};
+
+	/**
+	 * \brief The params of the customization.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 */
+	template <std::integral TVertex, weight TWeight, weight_calculator_for<TVertex> TWeightCalculator>
+	struct customization_params
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the result type.
+		 */
+		using hierarchy_t = ch::hierarchy_t<TVertex, TWeight>;
+
+		/**
+		 * \brief The topology to be customized.
+		 */
+		const topology_t<TVertex, TWeight>* topology{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero. The weight calculator will be invoked concurrently.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The amount of threads to be used. If set to 0, ``std::thread::hardware_concurrency`` is used.
+		 */
+		std::size_t threadCount{ 1 };
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Executes the metric independent preprocessing.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \param params The build_params object.
+	 * \return Returns the created topology.
+	 * \ingroup customizable_contraction_hierarchy
+	 */
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	cch::topology_t<TVertex, TWeight> build_topology(const cch::build_params<TVertex, TWeight>& params)
+	{
+		return cch::topology_t<TVertex, TWeight>{ params.graph };
+	}
+
+	/**
+	 * \brief Applies the weight calculator to the topology.
+	 * \tparam TArgs Template arguments for the customization_params.
+	 * \param params The customization_params object.
+	 * \return Returns the customized hierarchy, which may be queried via ``ch::query_t`` or ``find_path``.
+	 * \ingroup customizable_contraction_hierarchy
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	typename cch::customization_params<TArgs...>::hierarchy_t customize(cch::customization_params<TArgs...> params)
+	{
+		assert(params.topology);
+		return params.topology->customize(params.weightCalculator, params.threadCount);
+	}
+}
+
+#endif
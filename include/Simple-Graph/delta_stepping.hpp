@@ -0,0 +1,400 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_DELTA_STEPPING_HPP
+#define SIMPLE_GRAPH_DELTA_STEPPING_HPP
+
+#pragma once
+
+#include "parallel_helper.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::delta_stepping
+{
+	/** \addtogroup delta_stepping
+	* @{
+	* \brief Provides the search_params and other related things modeling the parallel delta-stepping single-source-shortest-path
+	* algorithm.
+	* \details Delta-stepping operates on graphs with dense vertex ids, thus each vertex must be an integral value in the range
+	* ``[0, vertexCount)``. The tentative distances are sorted into buckets of width ``delta``; each bucket is settled by relaxing
+	* its light edges (weight <= delta) until the bucket stays empty, followed by a single relaxation of the heavy edges. All
+	* relaxations of a bucket are executed in parallel.
+	*/
+
+	/**
+	 * \brief The result type of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	struct result_t
+	{
+		/**
+		 * \brief The distance of each vertex, indexed by its id. Unreachable vertices are set to ``std::nullopt``.
+		 */
+		std::vector<std::optional<TWeight>> distances{};
+
+		/**
+		 * \brief The predecessor of each vertex on one of its shortest paths, indexed by its id. The begin vertex and all
+		 * unreachable vertices are set to ``std::nullopt``.
+		 */
+		std::vector<std::optional<TVertex>> predecessors{};
+	};
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 */
+	template <
+		std::integral TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator>
+		requires std::is_arithmetic_v<detail::weight_type_of_t<TWeightCalculator, TVertex>>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::remove_cvref_t<TVertex>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the result type.
+		 */
+		using result_t = delta_stepping::result_t<vertex_t, weight_t>;
+
+		/**
+		 * \brief The vertex to start the traversal.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The total amount of vertices. Each vertex must be in the range ``[0, vertexCount)``.
+		 */
+		std::size_t vertexCount{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 * \attention The neighbor searcher will be invoked concurrently.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero. The weight calculator will be invoked concurrently.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The bucket width. Edges with a weight less or equal to delta are treated as light, all others as heavy.
+		 * \attention Must be greater than zero.
+		 * \details Small values result in many, but cheap, buckets (approaching dijkstra), while large values reduce the amount of
+		 * synchronization points, but may relax vertices multiple times (approaching bellman-ford). The average edge weight is
+		 * usually a good starting point.
+		 */
+		weight_t delta{ 1 };
+
+		/**
+		 * \brief The amount of threads to be used. If set to 0, ``std::thread::hardware_concurrency`` is used.
+		 */
+		std::size_t threadCount{ 1 };
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TVertex, class TWeight>
+	struct delta_stepping_request_t
+	{
+		TVertex vertex{};
+		TVertex predecessor{};
+		TWeight distance{};
+	};
+
+	template <class TVertex, class TWeight>
+	class delta_stepping_engine
+	{
+	public:
+		using vertex_t = TVertex;
+		using weight_t = TWeight;
+		using request_t = delta_stepping_request_t<vertex_t, weight_t>;
+
+		static constexpr weight_t infinity{ std::numeric_limits<weight_t>::max() };
+		static constexpr std::size_t no_bucket{ std::numeric_limits<std::size_t>::max() };
+
+		delta_stepping_engine(std::size_t vertexCount, weight_t delta, std::size_t threadCount)
+			: m_Delta{ delta },
+			m_ThreadCount{ threadCount },
+			m_Distances(vertexCount, infinity),
+			m_Predecessors(vertexCount),
+			m_BucketIndices(vertexCount, no_bucket),
+			m_Buckets(threadCount),
+			m_Settled(threadCount),
+			m_Requests(threadCount, std::vector<std::vector<request_t>>(threadCount)),
+			m_Barrier{ threadCount }
+		{
+			assert(weight_t{} < delta && "delta must be greater than zero.");
+		}
+
+		void run(vertex_t begin, auto& neighborSearcher, auto& weightCalculator)
+		{
+			assert(static_cast<std::size_t>(begin) < std::size(m_Distances) && "begin is out of range.");
+
+			emplace_requests(owner_of(begin), std::vector<request_t>{ { .vertex = begin, .predecessor = begin, .distance = {} } });
+			m_Predecessors[static_cast<std::size_t>(begin)].reset();
+
+			run_parallel
+			(
+				m_ThreadCount,
+				m_Barrier,
+				[&](const std::size_t threadIndex)
+				{
+					process_buckets(threadIndex, neighborSearcher, weightCalculator);
+				}
+			);
+		}
+
+		template <class TResult>
+		[[nodiscard]]
+		TResult take_result()
+		{
+			TResult result{};
+			result.distances.reserve(std::size(m_Distances));
+			for (const weight_t& distance : m_Distances)
+			{
+				result.distances.emplace_back(distance == infinity ? std::nullopt : std::optional<weight_t>{ distance });
+			}
+			result.predecessors = std::move(m_Predecessors);
+			return result;
+		}
+
+	private:
+		weight_t m_Delta;
+		std::size_t m_ThreadCount;
+		std::vector<weight_t> m_Distances;
+		std::vector<std::optional<vertex_t>> m_Predecessors;
+		std::vector<std::size_t> m_BucketIndices;
+		// each thread owns the vertices v with v % threadCount == threadIndex and solely modifies their states and buckets
+		std::vector<std::map<std::size_t, std::vector<vertex_t>>> m_Buckets;
+		std::vector<std::vector<vertex_t>> m_Settled;
+		// m_Requests[generatingThread][owningThread]
+		std::vector<std::vector<std::vector<request_t>>> m_Requests;
+		thread_barrier m_Barrier;
+		std::size_t m_CurrentBucket{};
+		bool m_Proceed{};
+
+		[[nodiscard]]
+		std::size_t owner_of(const vertex_t& v) const noexcept
+		{
+			return static_cast<std::size_t>(v) % m_ThreadCount;
+		}
+
+		void emplace_requests(std::size_t owner, const std::vector<request_t>& requests)
+		{
+			for (const request_t& request : requests)
+			{
+				const auto index{ static_cast<std::size_t>(request.vertex) };
+				if (request.distance < m_Distances[index])
+				{
+					m_Distances[index] = request.distance;
+					m_Predecessors[index] = request.predecessor;
+
+					if (const auto bucket{ static_cast<std::size_t>(request.distance / m_Delta) }; bucket != m_BucketIndices[index])
+					{
+						m_BucketIndices[index] = bucket;
+						m_Buckets[owner][bucket].emplace_back(request.vertex);
+					}
+				}
+			}
+		}
+
+		void relax_requests(std::size_t threadIndex)
+		{
+			for (auto& requests : m_Requests)
+			{
+				emplace_requests(threadIndex, requests[threadIndex]);
+				requests[threadIndex].clear();
+			}
+		}
+
+		template <bool VLight>
+		void generate_requests(std::size_t threadIndex, const std::vector<vertex_t>& vertices, auto& neighborSearcher, auto& weightCalculator)
+		{
+			auto& requests = m_Requests[threadIndex];
+			for (const vertex_t& predecessor : vertices)
+			{
+				const weight_t distance{ m_Distances[static_cast<std::size_t>(predecessor)] };
+				for (const vertex_t& cur_vertex : std::invoke(neighborSearcher, predecessor))
+				{
+					assert(static_cast<std::size_t>(cur_vertex) < std::size(m_Distances) && "vertex is out of range.");
+
+					const weight_t rel_weight{ std::invoke(weightCalculator, predecessor, cur_vertex) };
+					assert(weight_t{} <= rel_weight && "relative weight between nodes must be greater or equal zero.");
+
+					if ((rel_weight <= m_Delta) == VLight)
+					{
+						requests[owner_of(cur_vertex)].push_back({ .vertex = cur_vertex, .predecessor = predecessor, .distance = distance + rel_weight });
+					}
+				}
+			}
+		}
+
+		bool has_pending_vertices(std::size_t bucket) const
+		{
+			return std::ranges::any_of
+			(
+				m_Buckets,
+				[bucket](const auto& buckets)
+				{
+					const auto itr = buckets.find(bucket);
+					return itr != std::end(buckets) && !std::empty(itr->second);
+				}
+			);
+		}
+
+		void select_next_bucket()
+		{
+			m_Proceed = false;
+			for (auto& buckets : m_Buckets)
+			{
+				std::erase_if(buckets, [](const auto& pair) { return std::empty(pair.second); });
+				if (!std::empty(buckets) && (!m_Proceed || std::begin(buckets)->first < m_CurrentBucket))
+				{
+					m_CurrentBucket = std::begin(buckets)->first;
+					m_Proceed = true;
+				}
+			}
+		}
+
+		void process_buckets(std::size_t threadIndex, auto& neighborSearcher, auto& weightCalculator)
+		{
+			std::vector<vertex_t> frontier{};
+			auto& settled = m_Settled[threadIndex];
+			while (true)
+			{
+				if (threadIndex == 0)
+				{
+					select_next_bucket();
+				}
+				m_Barrier.arrive_and_wait();
+				if (!m_Proceed)
+				{
+					return;
+				}
+				const std::size_t currentBucket{ m_CurrentBucket };
+
+				do
+				{
+					// phase 1: take over the current bucket and generate light requests
+					frontier.clear();
+					if (const auto itr = m_Buckets[threadIndex].find(currentBucket); itr != std::end(m_Buckets[threadIndex]))
+					{
+						for (const vertex_t& v : std::exchange(itr->second, {}))
+						{
+							// vertices may have been moved to another bucket in the meantime
+							if (auto& bucketIndex = m_BucketIndices[static_cast<std::size_t>(v)]; bucketIndex == currentBucket)
+							{
+								bucketIndex = no_bucket;
+								frontier.emplace_back(v);
+							}
+						}
+					}
+					settled.insert(std::end(settled), std::begin(frontier), std::end(frontier));
+					generate_requests<true>(threadIndex, frontier, neighborSearcher, weightCalculator);
+					m_Barrier.arrive_and_wait();
+
+					// phase 2: relax all requests of owned vertices
+					relax_requests(threadIndex);
+					m_Barrier.arrive_and_wait();
+
+					if (threadIndex == 0)
+					{
+						m_Proceed = has_pending_vertices(currentBucket);
+					}
+					m_Barrier.arrive_and_wait();
+				}
+				while (m_Proceed);
+
+				// heavy edges may never lead back into the current bucket, thus relaxing them once suffices
+				generate_requests<false>(threadIndex, settled, neighborSearcher, weightCalculator);
+				settled.clear();
+				m_Barrier.arrive_and_wait();
+				relax_requests(threadIndex);
+				m_Barrier.arrive_and_wait();
+			}
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Computes the shortest distances from the begin vertex to all other vertices in parallel.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns the distances and predecessors of all vertices.
+	 * \details The resulting distances are identical to the distances reported by a complete ``traverse`` of an equally configured
+	 * ``dijkstra::search_params``. On ties, the predecessors may differ, though.
+	 * If the neighbor searcher or weight calculator throws on any thread, all threads are stopped and the first exception is
+	 * rethrown on the calling thread.
+	 * \ingroup delta_stepping
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	typename delta_stepping::search_params<TArgs...>::result_t shortest_paths(delta_stepping::search_params<TArgs...> params)
+	{
+		using params_t = delta_stepping::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using weight_t = typename params_t::weight_t;
+
+		detail::delta_stepping_engine<vertex_t, weight_t> engine
+		{
+			params.vertexCount,
+			params.delta,
+			detail::resolve_thread_count(params.threadCount)
+		};
+		engine.run(params.begin, params.neighborSearcher, params.weightCalculator);
+		return engine.template take_result<typename params_t::result_t>();
+	}
+}
+
+#endif
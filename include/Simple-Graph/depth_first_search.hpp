@@ -11,8 +11,12 @@
 #include "generic_traverse.hpp"
 #include "stack_helper.hpp"
 #include "utility.hpp"
+#include "workspace.hpp"
 
 #include <map>
+#include <optional>
+#include <span>
+#include <stop_token>
 
 namespace sl::graph::dfs
 {
@@ -38,6 +42,19 @@ namespace sl::graph::dfs
 	template <vertex_descriptor TVertex>
 	using default_open_list_t = std::stack<node_t<TVertex>>;
 
+	/**
+	 * \brief The workspace type of the algorithm.
+	 * \note The default state map and predecessor map are node based, thus they still allocate on warmed up workspaces.
+	 * Exchange them for dense random access containers, if the searches shall not allocate at all.
+	 * \see search_workspace for details.
+	 */
+	template <
+		vertex_descriptor TVertex,
+		state_map_for<TVertex, state_t> TStateMap = std::map<TVertex, state_t>,
+		open_list_for<node_t<TVertex>> TOpenList = default_open_list_t<TVertex>,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
+	using workspace_t = search_workspace<TVertex, TStateMap, TOpenList, TPredecessorMap>;
+
 	/**
 	 * \brief The search_params of the algorithm.
 	 * \tparam TVertex The vertex type.
@@ -150,6 +167,20 @@ namespace sl::graph::dfs
 		 * open list should model the behaviour of a stack-like container. Otherwise this results in undefined behaviour.
 		 */
 		TOpenList openList{};
+
+		/**
+		 * \brief The stop token, which allows to cancel the algorithm cooperatively, e.g. from another thread.
+		 * \remark If not set, the algorithm can not be cancelled.
+		 * \details A cancelled algorithm simply returns as if the callback had requested the interruption. ``find_path`` thus
+		 * returns ``std::nullopt``, if the destination has not been found until then.
+		 */
+		std::optional<std::stop_token> stopToken{};
+
+		/**
+		 * \brief The number of visited nodes in between two checks of the stop token.
+		 * \details Greater values reduce the overhead of the checks, but delay the reaction to a stop request.
+		 */
+		std::size_t stopCheckInterval{ 1 };
 	};
 
 	/** @}*/
@@ -164,7 +195,7 @@ namespace sl::graph
 	 * \ingroup dfs
 	 */
 	template <class... TArgs>
-	void traverse(dfs::search_params<TArgs...> params)
+	constexpr void traverse(dfs::search_params<TArgs...> params)
 	{
 		using params_t = dfs::search_params<TArgs...>;
 		using vertex_t = typename params_t::vertex_t;
@@ -178,7 +209,8 @@ namespace sl::graph
 			std::ref(params.callback),
 			std::ref(params.vertexPredicate),
 			std::move(params.stateMap),
-			std::move(params.openList)
+			std::move(params.openList),
+			detail::stop_checker{ params.stopToken, params.stopCheckInterval }
 		);
 	}
 
@@ -186,6 +218,7 @@ namespace sl::graph
 	 * \brief Executes the algorithm and returns a vector, where each element is a vertex on the existing path.
 	 * \tparam TArgs Template arguments for the search_params.
 	 * \tparam TVertex The used vertex type. Do not change!
+	 * \tparam TPredecessorMap The predecessor map type.
 	 * \param params The search_params object.
 	 * \param predecessorMap The provided predecessor map, where each predecessor will be stored in between.
 	 * \return Returns the path as vector if exists. Otherwise ``std::nullopt`` is returned.
@@ -196,12 +229,15 @@ namespace sl::graph
 	 * \attention If the predecessorMap contains any predefined graph state, the behaviour is this function is undefined.
 	 * \ingroup dfs
 	 */
-	template <class... TArgs, vertex_descriptor TVertex = typename dfs::search_params<TArgs...>::vertex_t>
+	template <
+		class... TArgs,
+		vertex_descriptor TVertex = typename dfs::search_params<TArgs...>::vertex_t,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
 	[[nodiscard]]
-	std::optional<std::vector<TVertex>> find_path
+	constexpr std::optional<std::vector<TVertex>> find_path
 	(
 		dfs::search_params<TArgs...> params,
-		predecessor_map_for<TVertex> auto predecessorMap = std::map<TVertex, std::optional<TVertex>>{}
+		TPredecessorMap predecessorMap = {}
 	)
 	{
 		using params_t = dfs::search_params<TArgs...>;
@@ -222,7 +258,135 @@ namespace sl::graph
 					std::ref(path_extractor),
 					std::ref(params.vertexPredicate),
 					std::move(params.stateMap),
-					std::move(params.openList)
+					std::move(params.openList),
+					detail::stop_checker{ params.stopToken, params.stopCheckInterval }
+				);
+			}
+		);
+	}
+
+	/**
+	 * \brief Overload for dfs::search_params, which uses the containers of the provided workspace.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TWorkspaceArgs Template arguments for the workspace.
+	 * \param params The search_params object. Its state map and open list prototypes are ignored.
+	 * \param workspace The workspace, which will be cleared in beforehand.
+	 * \ingroup dfs
+	 */
+	template <class... TArgs, class... TWorkspaceArgs>
+	void traverse(dfs::search_params<TArgs...> params, search_workspace<TWorkspaceArgs...>& workspace)
+	{
+		using params_t = dfs::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		workspace.clear();
+		detail::uniform_cost_traverse<node_t>
+		(
+			detail::make_weighted_node_factory<vertex_t>(constant_t<1>{}),
+			{ .vertex = std::move(params.begin) },
+			std::ref(params.neighborSearcher),
+			std::ref(params.callback),
+			std::ref(params.vertexPredicate),
+			workspace.stateMap,
+			workspace.openList,
+			detail::stop_checker{ params.stopToken, params.stopCheckInterval }
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm on the containers of the provided workspace and stores the found path in its path buffer.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TWorkspaceArgs Template arguments for the workspace.
+	 * \param params The search_params object. Its state map and open list prototypes are ignored.
+	 * \param workspace The workspace, which will be cleared in beforehand.
+	 * \return Returns a view to the path buffer of the workspace, if a path exists. Otherwise ``std::nullopt`` is returned.
+	 * \details Behaves like the ordinary ``find_path`` overload, but reuses the containers of the workspace. Once the workspace
+	 * is warmed up, nothing is allocated any more, if its state map and predecessor map are dense random access containers.
+	 * \note The path will be ordered from destination to begin, thus reversed. The returned span is invalidated by the next
+	 * usage of the workspace.
+	 * \ingroup dfs
+	 */
+	template <class... TArgs, class... TWorkspaceArgs>
+	[[nodiscard]]
+	std::optional<std::span<const typename dfs::search_params<TArgs...>::vertex_t>> find_path
+	(
+		dfs::search_params<TArgs...> params,
+		search_workspace<TWorkspaceArgs...>& workspace
+	)
+	{
+		using params_t = dfs::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::extract_path_into<node_t>
+		(
+			params.callback,
+			workspace,
+			[&](auto path_recorder)
+			{
+				detail::uniform_cost_traverse<node_t>
+				(
+					detail::make_weighted_node_factory<vertex_t>(constant_t<1>{}),
+					{ .vertex = std::move(params.begin) },
+					std::ref(params.neighborSearcher),
+					std::ref(path_recorder),
+					std::ref(params.vertexPredicate),
+					workspace.stateMap,
+					workspace.openList,
+					detail::stop_checker{ params.stopToken, params.stopCheckInterval }
+				);
+			}
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm on the containers of the provided workspace and writes the found path into the provided buffer.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TWorkspaceArgs Template arguments for the workspace.
+	 * \param params The search_params object. Its state map and open list prototypes are ignored.
+	 * \param workspace The workspace, which will be cleared in beforehand. Its path buffer remains unused.
+	 * \param buffer The buffer, which receives the path.
+	 * \param order The order, in which the path will be written.
+	 * \return Returns the length of the path, if a path exists. Otherwise ``std::nullopt`` is returned.
+	 * \details The path is written to the front of the buffer. If the buffer is too small, nothing will be written at all and
+	 * the returned length exceeds the buffer size; the caller may then retry with a sufficiently large buffer.
+	 * \note The path itself needs no allocation, but the search still allocates within node based state and predecessor
+	 * maps (e.g. the ``std::map`` defaults). Use dense random access containers for allocation free searches.
+	 * \ingroup dfs
+	 */
+	template <class... TArgs, class... TWorkspaceArgs>
+	[[nodiscard]]
+	std::optional<std::size_t> find_path
+	(
+		dfs::search_params<TArgs...> params,
+		search_workspace<TWorkspaceArgs...>& workspace,
+		std::span<typename dfs::search_params<TArgs...>::vertex_t> buffer,
+		path_order order = path_order::reversed
+	)
+	{
+		using params_t = dfs::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::extract_path_into<node_t>
+		(
+			params.callback,
+			workspace,
+			buffer,
+			order,
+			[&](auto path_recorder)
+			{
+				detail::uniform_cost_traverse<node_t>
+				(
+					detail::make_weighted_node_factory<vertex_t>(constant_t<1>{}),
+					{ .vertex = std::move(params.begin) },
+					std::ref(params.neighborSearcher),
+					std::ref(path_recorder),
+					std::ref(params.vertexPredicate),
+					workspace.stateMap,
+					workspace.openList,
+					detail::stop_checker{ params.stopToken, params.stopCheckInterval }
 				);
 			}
 		);
@@ -9,10 +9,15 @@
 #pragma once
 
 #include "generic_traverse.hpp"
+#include "path_finder.hpp"
 #include "queue_helper.hpp"
 #include "utility.hpp"
+#include "workspace.hpp"
 
 #include <map>
+#include <optional>
+#include <span>
+#include <stop_token>
 
 namespace sl::graph::dijkstra
 {
@@ -39,6 +44,20 @@ namespace sl::graph::dijkstra
 	template <vertex_descriptor TVertex, weight TWeight>
 	using default_open_list_t = std::priority_queue<node_t<TVertex, TWeight>, std::vector<node_t<TVertex, TWeight>>, std::greater<>>;
 
+	/**
+	 * \brief The workspace type of the algorithm.
+	 * \note The default state map and predecessor map are node based, thus they still allocate on warmed up workspaces.
+	 * Exchange them for dense random access containers, if the searches shall not allocate at all.
+	 * \see search_workspace for details.
+	 */
+	template <
+		vertex_descriptor TVertex,
+		weight TWeight,
+		state_map_for<TVertex, state_t<TWeight>> TStateMap = std::map<TVertex, state_t<TWeight>>,
+		open_list_for<node_t<TVertex, TWeight>> TOpenList = default_open_list_t<TVertex, TWeight>,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
+	using workspace_t = search_workspace<TVertex, TStateMap, TOpenList, TPredecessorMap>;
+
 	/**
 	 * \brief The search_params of the algorithm.
 	 * \tparam TVertex The vertex type.
@@ -170,6 +189,29 @@ namespace sl::graph::dijkstra
 		 * open list should model the behaviour of a priority-queue-like container. Otherwise this results in undefined behaviour.
 		 */
 		TOpenList openList{};
+
+		/**
+		 * \brief The stop token, which allows to cancel the algorithm cooperatively, e.g. from another thread.
+		 * \remark If not set, the algorithm can not be cancelled.
+		 * \details A cancelled algorithm simply returns as if the callback had requested the interruption. ``find_path`` thus
+		 * returns ``std::nullopt``, if the destination has not been found until then.
+		 */
+		std::optional<std::stop_token> stopToken{};
+
+		/**
+		 * \brief The number of visited nodes in between two checks of the stop token.
+		 * \details Greater values reduce the overhead of the checks, but delay the reaction to a stop request.
+		 */
+		std::size_t stopCheckInterval{ 1 };
+
+		/**
+		 * \brief Determines how the visited nodes will be expanded.
+		 * \remark If not set, each neighbor is processed directly.
+		 * \details ``expansion_mode::prefetched`` may speed up traversals of large graphs with dense state maps, but does not
+		 * alter the results.
+		 * \see expansion_mode for details.
+		 */
+		expansion_mode expansionMode{ expansion_mode::direct };
 	};
 
 	/** @}*/
@@ -184,7 +226,7 @@ namespace sl::graph
 	 * \ingroup dijkstra
 	 */
 	template <class... TArgs>
-	void traverse(dijkstra::search_params<TArgs...> params)
+	constexpr void traverse(dijkstra::search_params<TArgs...> params)
 	{
 		using params_t = dijkstra::search_params<TArgs...>;
 		using vertex_t = typename params_t::vertex_t;
@@ -198,7 +240,9 @@ namespace sl::graph
 			std::ref(params.callback),
 			std::ref(params.vertexPredicate),
 			std::move(params.stateMap),
-			std::move(params.openList)
+			std::move(params.openList),
+			detail::stop_checker{ params.stopToken, params.stopCheckInterval },
+			params.expansionMode
 		);
 	}
 
@@ -206,6 +250,7 @@ namespace sl::graph
 	 * \brief Executes the algorithm and returns a vector, where each element is a vertex on the existing path.
 	 * \tparam TArgs Template arguments for the search_params.
 	 * \tparam TVertex The used vertex type. Do not change!
+	 * \tparam TPredecessorMap The predecessor map type.
 	 * \param params The search_params object.
 	 * \param predecessorMap The provided predecessor map, where each predecessor will be stored in between.
 	 * \return Returns the path as vector if exists. Otherwise ``std::nullopt`` is returned.
@@ -216,12 +261,15 @@ namespace sl::graph
 	 * \attention If the predecessorMap contains any predefined graph state, the behaviour is this function is undefined.
 	 * \ingroup dijkstra
 	 */
-	template <class... TArgs, vertex_descriptor TVertex = typename dijkstra::search_params<TArgs...>::vertex_t>
+	template <
+		class... TArgs,
+		vertex_descriptor TVertex = typename dijkstra::search_params<TArgs...>::vertex_t,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
 	[[nodiscard]]
-	std::optional<std::vector<TVertex>> find_path
+	constexpr std::optional<std::vector<TVertex>> find_path
 	(
 		dijkstra::search_params<TArgs...> params,
-		predecessor_map_for<TVertex> auto predecessorMap = std::map<TVertex, std::optional<TVertex>>{}
+		TPredecessorMap predecessorMap = {}
 	)
 	{
 		using params_t = dijkstra::search_params<TArgs...>;
@@ -242,7 +290,197 @@ namespace sl::graph
 					std::ref(path_extractor),
 					std::ref(params.vertexPredicate),
 					std::move(params.stateMap),
-					std::move(params.openList)
+					std::move(params.openList),
+					detail::stop_checker{ params.stopToken, params.stopCheckInterval },
+					params.expansionMode
+				);
+			}
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm once and returns the paths to each of the given targets.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TVertex The used vertex type. Do not change!
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \param params The search_params object.
+	 * \param targets A range of target vertices. If the vertex type is totally ordered, each settled vertex is looked up via binary
+	 * search, otherwise linearly.
+	 * \param predecessorMap The provided predecessor map, where each predecessor will be stored in between.
+	 * \return Returns a vector with one element per target (in the same order), which is either the path to that target or
+	 * ``std::nullopt``, if the target is unreachable.
+	 * \details All paths share one search tree, which will be expanded until each target has been settled. Thus a query to
+	 * n targets costs about as much as the query to the farthest target. The callback may return true to abort the
+	 * algorithm early, which leaves the remaining targets unreached. For an additional cost bound, see the ``isochrone``
+	 * overload.
+	 * \note The paths will be ordered from destination to begin, thus reversed.
+	 * \attention If the predecessorMap contains any predefined graph state, the behaviour is this function is undefined.
+	 * \ingroup dijkstra
+	 */
+	template <
+		class... TArgs,
+		vertex_descriptor TVertex = typename dijkstra::search_params<TArgs...>::vertex_t,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
+	[[nodiscard]]
+	std::vector<std::optional<std::vector<TVertex>>> find_paths
+	(
+		dijkstra::search_params<TArgs...> params,
+		const std::ranges::input_range auto& targets,
+		TPredecessorMap predecessorMap = {}
+	)
+	{
+		using params_t = dijkstra::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::extract_paths<node_t>
+		(
+			std::ref(params.callback),
+			targets,
+			std::move(predecessorMap),
+			[&](auto path_extractor)
+			{
+				detail::dynamic_cost_traverse<node_t>
+				(
+					detail::make_weighted_node_factory<vertex_t>(std::ref(params.weightCalculator)),
+					{ .vertex = std::move(params.begin) },
+					std::ref(params.neighborSearcher),
+					std::ref(path_extractor),
+					std::ref(params.vertexPredicate),
+					std::move(params.stateMap),
+					std::move(params.openList),
+					detail::stop_checker{ params.stopToken, params.stopCheckInterval },
+					params.expansionMode
+				);
+			}
+		);
+	}
+
+	/**
+	 * \brief Overload for dijkstra::search_params, which uses the containers of the provided workspace.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TWorkspaceArgs Template arguments for the workspace.
+	 * \param params The search_params object. Its state map and open list prototypes are ignored.
+	 * \param workspace The workspace, which will be cleared in beforehand.
+	 * \ingroup dijkstra
+	 */
+	template <class... TArgs, class... TWorkspaceArgs>
+	void traverse(dijkstra::search_params<TArgs...> params, search_workspace<TWorkspaceArgs...>& workspace)
+	{
+		using params_t = dijkstra::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		workspace.clear();
+		detail::dynamic_cost_traverse<node_t>
+		(
+			detail::make_weighted_node_factory<vertex_t>(std::ref(params.weightCalculator)),
+			{ .vertex = std::move(params.begin) },
+			std::ref(params.neighborSearcher),
+			std::ref(params.callback),
+			std::ref(params.vertexPredicate),
+			workspace.stateMap,
+			workspace.openList,
+			detail::stop_checker{ params.stopToken, params.stopCheckInterval },
+			params.expansionMode
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm on the containers of the provided workspace and stores the found path in its path buffer.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TWorkspaceArgs Template arguments for the workspace.
+	 * \param params The search_params object. Its state map and open list prototypes are ignored.
+	 * \param workspace The workspace, which will be cleared in beforehand.
+	 * \return Returns a view to the path buffer of the workspace, if a path exists. Otherwise ``std::nullopt`` is returned.
+	 * \details Behaves like the ordinary ``find_path`` overload, but reuses the containers of the workspace. Once the workspace
+	 * is warmed up, nothing is allocated any more, if its state map and predecessor map are dense random access containers.
+	 * \note The path will be ordered from destination to begin, thus reversed. The returned span is invalidated by the next
+	 * usage of the workspace.
+	 * \ingroup dijkstra
+	 */
+	template <class... TArgs, class... TWorkspaceArgs>
+	[[nodiscard]]
+	std::optional<std::span<const typename dijkstra::search_params<TArgs...>::vertex_t>> find_path
+	(
+		dijkstra::search_params<TArgs...> params,
+		search_workspace<TWorkspaceArgs...>& workspace
+	)
+	{
+		using params_t = dijkstra::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::extract_path_into<node_t>
+		(
+			params.callback,
+			workspace,
+			[&](auto path_recorder)
+			{
+				detail::dynamic_cost_traverse<node_t>
+				(
+					detail::make_weighted_node_factory<vertex_t>(std::ref(params.weightCalculator)),
+					{ .vertex = std::move(params.begin) },
+					std::ref(params.neighborSearcher),
+					std::ref(path_recorder),
+					std::ref(params.vertexPredicate),
+					workspace.stateMap,
+					workspace.openList,
+					detail::stop_checker{ params.stopToken, params.stopCheckInterval },
+					params.expansionMode
+				);
+			}
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm on the containers of the provided workspace and writes the found path into the provided buffer.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TWorkspaceArgs Template arguments for the workspace.
+	 * \param params The search_params object. Its state map and open list prototypes are ignored.
+	 * \param workspace The workspace, which will be cleared in beforehand. Its path buffer remains unused.
+	 * \param buffer The buffer, which receives the path.
+	 * \param order The order, in which the path will be written.
+	 * \return Returns the length of the path, if a path exists. Otherwise ``std::nullopt`` is returned.
+	 * \details The path is written to the front of the buffer. If the buffer is too small, nothing will be written at all and
+	 * the returned length exceeds the buffer size; the caller may then retry with a sufficiently large buffer.
+	 * \note The path itself needs no allocation, but the search still allocates within node based state and predecessor
+	 * maps (e.g. the ``std::map`` defaults). Use dense random access containers for allocation free searches.
+	 * \ingroup dijkstra
+	 */
+	template <class... TArgs, class... TWorkspaceArgs>
+	[[nodiscard]]
+	std::optional<std::size_t> find_path
+	(
+		dijkstra::search_params<TArgs...> params,
+		search_workspace<TWorkspaceArgs...>& workspace,
+		std::span<typename dijkstra::search_params<TArgs...>::vertex_t> buffer,
+		path_order order = path_order::reversed
+	)
+	{
+		using params_t = dijkstra::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::extract_path_into<node_t>
+		(
+			params.callback,
+			workspace,
+			buffer,
+			order,
+			[&](auto path_recorder)
+			{
+				detail::dynamic_cost_traverse<node_t>
+				(
+					detail::make_weighted_node_factory<vertex_t>(std::ref(params.weightCalculator)),
+					{ .vertex = std::move(params.begin) },
+					std::ref(params.neighborSearcher),
+					std::ref(path_recorder),
+					std::ref(params.vertexPredicate),
+					workspace.stateMap,
+					workspace.openList,
+					detail::stop_checker{ params.stopToken, params.stopCheckInterval },
+					params.expansionMode
 				);
 			}
 		);
@@ -0,0 +1,525 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_FIXED_CAPACITY_HPP
+#define SIMPLE_GRAPH_FIXED_CAPACITY_HPP
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace sl::graph
+{
+	/** \addtogroup fixed_capacity
+	* @{
+	* \brief Provides state maps and open lists with a fixed capacity, which neither allocate nor hinder constant evaluation.
+	* \details The default containers of the algorithms (``std::map``, ``std::priority_queue``, ``std::queue`` and ``std::stack``)
+	* can not be used in constant expressions. The types of this group store their elements in a ``std::array`` instead, thus
+	* ``traverse`` and ``find_path`` may be evaluated at compile time, when the vertices are dense ids.
+	* \code
+	* constexpr auto distances = []
+	* {
+	*	std::array<int, 4> result{};
+	*	traverse
+	*	(
+	*		dijkstra::search_params
+	*		{
+	*			...
+	*			.callback = [&](const auto& node) { result[node.vertex] = node.weight_sum; },
+	*			.stateMap = fixed_state_map<dijkstra::state_t<int>, 4>{},
+	*			.openList = fixed_priority_queue<dijkstra::node_t<int, int>, 16, std::greater<>>{}
+	*		}
+	*	);
+	*	return result;
+	* }();
+	* \endcode
+	* \attention Exceeding the capacity is undefined behaviour and fails the constant evaluation. As dijkstra and astar may insert
+	* a vertex multiple times, their open lists should provide space for one node per edge.
+	* \remark The search_params hold a ``std::optional<std::stop_token>``, thus constant evaluation requires a constexpr
+	* ``std::optional`` destructor (``__cpp_lib_optional >= 202106L``). ``find_path`` additionally requires a constexpr
+	* ``std::vector`` (``__cpp_lib_constexpr_vector``). Both are provided by e.g. libstdc++ since gcc12.
+	*/
+
+	/**
+	 * \brief State map with a fixed capacity, which is indexed by dense vertex ids.
+	 * \tparam TState The state type. Must be default constructible.
+	 * \tparam VCapacity The amount of vertices. Each vertex must be in the range ``[0, VCapacity)``.
+	 * \details As ``std::optional<vertex_t>`` is a valid state type, this type may also be used as predecessor map.
+	 */
+	template <class TState, std::size_t VCapacity>
+	class fixed_state_map
+	{
+	public:
+		/**
+		 * \brief Alias for the state type.
+		 */
+		using value_type = TState;
+
+		/**
+		 * \brief Default constructor. All states are value initialized.
+		 */
+		constexpr fixed_state_map()
+		{
+			// gcc fails to evaluate value initialized arrays of tuples as constant expressions, thus assign the states afterwards
+			std::ranges::fill(m_States, TState{});
+		}
+
+		/**
+		 * \brief Returns the state of the given vertex.
+		 */
+		[[nodiscard]]
+		constexpr TState& operator [](const std::integral auto& v) noexcept
+		{
+			assert(0 <= v && static_cast<std::size_t>(v) < VCapacity && "vertex is out of range.");
+			return m_States[static_cast<std::size_t>(v)];
+		}
+
+		/**
+		 * \copydoc operator[]
+		 */
+		[[nodiscard]]
+		constexpr const TState& operator [](const std::integral auto& v) const noexcept
+		{
+			assert(0 <= v && static_cast<std::size_t>(v) < VCapacity && "vertex is out of range.");
+			return m_States[static_cast<std::size_t>(v)];
+		}
+
+		/**
+		 * \brief Returns the amount of vertices.
+		 */
+		[[nodiscard]]
+		static constexpr std::size_t size() noexcept
+		{
+			return VCapacity;
+		}
+
+		/**
+		 * \brief Returns an iterator to the first state.
+		 */
+		[[nodiscard]]
+		constexpr auto begin() noexcept
+		{
+			return std::begin(m_States);
+		}
+
+		/**
+		 * \copydoc begin
+		 */
+		[[nodiscard]]
+		constexpr auto begin() const noexcept
+		{
+			return std::begin(m_States);
+		}
+
+		/**
+		 * \brief Returns the end iterator.
+		 */
+		[[nodiscard]]
+		constexpr auto end() noexcept
+		{
+			return std::end(m_States);
+		}
+
+		/**
+		 * \copydoc end
+		 */
+		[[nodiscard]]
+		constexpr auto end() const noexcept
+		{
+			return std::end(m_States);
+		}
+
+	private:
+		std::array<TState, VCapacity> m_States;
+	};
+
+	/**
+	 * \brief First-in-first-out queue with a fixed capacity, which models ``std::queue``.
+	 * \tparam T The element type. Must be default constructible.
+	 * \tparam VCapacity The maximal amount of stored elements.
+	 * \details The elements are stored in a ring buffer.
+	 */
+	template <class T, std::size_t VCapacity>
+	class fixed_queue
+	{
+	public:
+		/**
+		 * \brief Alias for the element type.
+		 */
+		using value_type = T;
+
+		/**
+		 * \brief Returns the capacity.
+		 */
+		[[nodiscard]]
+		static constexpr std::size_t capacity() noexcept
+		{
+			return VCapacity;
+		}
+
+		/**
+		 * \brief Returns the amount of stored elements.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t size() const noexcept
+		{
+			return m_Size;
+		}
+
+		/**
+		 * \brief Determines whether any elements are stored.
+		 */
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return m_Size == 0;
+		}
+
+		/**
+		 * \brief Returns the oldest element.
+		 */
+		[[nodiscard]]
+		constexpr const T& front() const noexcept
+		{
+			assert(!empty());
+			return m_Elements[m_Begin];
+		}
+
+		/**
+		 * \brief Appends the element.
+		 */
+		constexpr void push(T element)
+		{
+			assert(m_Size < VCapacity && "capacity exceeded.");
+			m_Elements[(m_Begin + m_Size) % VCapacity] = std::move(element);
+			++m_Size;
+		}
+
+		/**
+		 * \brief Removes the oldest element.
+		 */
+		constexpr void pop() noexcept
+		{
+			assert(!empty());
+			m_Begin = (m_Begin + 1) % VCapacity;
+			--m_Size;
+		}
+
+		/**
+		 * \brief Removes all elements.
+		 */
+		constexpr void clear() noexcept
+		{
+			m_Begin = 0;
+			m_Size = 0;
+		}
+
+	private:
+		std::array<T, VCapacity> m_Elements{};
+		std::size_t m_Begin{ 0 };
+		std::size_t m_Size{ 0 };
+	};
+
+	/**
+	 * \brief Last-in-first-out stack with a fixed capacity, which models ``std::stack``.
+	 * \tparam T The element type. Must be default constructible.
+	 * \tparam VCapacity The maximal amount of stored elements.
+	 */
+	template <class T, std::size_t VCapacity>
+	class fixed_stack
+	{
+	public:
+		/**
+		 * \brief Alias for the element type.
+		 */
+		using value_type = T;
+
+		/**
+		 * \brief Returns the capacity.
+		 */
+		[[nodiscard]]
+		static constexpr std::size_t capacity() noexcept
+		{
+			return VCapacity;
+		}
+
+		/**
+		 * \brief Returns the amount of stored elements.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t size() const noexcept
+		{
+			return m_Size;
+		}
+
+		/**
+		 * \brief Determines whether any elements are stored.
+		 */
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return m_Size == 0;
+		}
+
+		/**
+		 * \brief Returns the most recently pushed element.
+		 */
+		[[nodiscard]]
+		constexpr const T& top() const noexcept
+		{
+			assert(!empty());
+			return m_Elements[m_Size - 1];
+		}
+
+		/**
+		 * \brief Pushes the element.
+		 */
+		constexpr void push(T element)
+		{
+			assert(m_Size < VCapacity && "capacity exceeded.");
+			m_Elements[m_Size++] = std::move(element);
+		}
+
+		/**
+		 * \brief Removes the most recently pushed element.
+		 */
+		constexpr void pop() noexcept
+		{
+			assert(!empty());
+			--m_Size;
+		}
+
+		/**
+		 * \brief Removes all elements.
+		 */
+		constexpr void clear() noexcept
+		{
+			m_Size = 0;
+		}
+
+	private:
+		std::array<T, VCapacity> m_Elements{};
+		std::size_t m_Size{ 0 };
+	};
+
+	/**
+	 * \brief Binary heap with a fixed capacity, which models ``std::priority_queue``.
+	 * \tparam T The element type. Must be default constructible.
+	 * \tparam VCapacity The maximal amount of stored elements.
+	 * \tparam TCompare The comparison type. As with ``std::priority_queue``, the greatest element is taken next, thus use
+	 * ``std::greater<>`` for dijkstra and astar.
+	 */
+	template <class T, std::size_t VCapacity, class TCompare = std::less<>>
+	class fixed_priority_queue
+	{
+	public:
+		/**
+		 * \brief Alias for the element type.
+		 */
+		using value_type = T;
+
+		/**
+		 * \brief Constructor.
+		 * \param compare The comparison object.
+		 */
+		constexpr explicit fixed_priority_queue(TCompare compare = {})
+			: m_Compare{ std::move(compare) }
+		{
+		}
+
+		/**
+		 * \brief Returns the capacity.
+		 */
+		[[nodiscard]]
+		static constexpr std::size_t capacity() noexcept
+		{
+			return VCapacity;
+		}
+
+		/**
+		 * \brief Returns the amount of stored elements.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t size() const noexcept
+		{
+			return m_Size;
+		}
+
+		/**
+		 * \brief Determines whether any elements are stored.
+		 */
+		[[nodiscard]]
+		constexpr bool empty() const noexcept
+		{
+			return m_Size == 0;
+		}
+
+		/**
+		 * \brief Returns the greatest element.
+		 */
+		[[nodiscard]]
+		constexpr const T& top() const noexcept
+		{
+			assert(!empty());
+			return m_Elements.front();
+		}
+
+		/**
+		 * \brief Inserts the element.
+		 */
+		constexpr void push(T element)
+		{
+			assert(m_Size < VCapacity && "capacity exceeded.");
+			m_Elements[m_Size++] = std::move(element);
+			std::push_heap(std::begin(m_Elements), std::begin(m_Elements) + m_Size, std::ref(m_Compare));
+		}
+
+		/**
+		 * \brief Removes the greatest element.
+		 */
+		constexpr void pop()
+		{
+			assert(!empty());
+			std::pop_heap(std::begin(m_Elements), std::begin(m_Elements) + m_Size, std::ref(m_Compare));
+			--m_Size;
+		}
+
+		/**
+		 * \brief Removes all elements.
+		 */
+		constexpr void clear() noexcept
+		{
+			m_Size = 0;
+		}
+
+	private:
+		TCompare m_Compare;
+		std::array<T, VCapacity> m_Elements{};
+		std::size_t m_Size{ 0 };
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class T>
+	struct fixed_capacity_take_next_t
+	{
+		using container_t = T;
+		using value_t = typename container_t::value_type;
+
+		[[nodiscard]]
+		constexpr value_t operator ()(container_t& container) const
+		{
+			value_t el{ [&]() -> const value_t&
+			{
+				if constexpr (requires { container.front(); })
+					return container.front();
+				else
+					return container.top();
+			}() };
+			container.pop();
+			return el;
+		}
+	};
+
+	template <class T>
+	struct fixed_capacity_emplace_t
+	{
+		using container_t = T;
+		using value_t = typename container_t::value_type;
+
+		template <class... TCTorArgs>
+		constexpr void operator ()(container_t& container, TCTorArgs&&... args) const
+		{
+			container.push(value_t{ std::forward<TCTorArgs>(args)... });
+		}
+	};
+}
+
+/** \addtogroup fixed_capacity
+* @{
+*/
+
+/**
+ * \brief Specialization for fixed_queue.
+ * \tparam T The element type.
+ * \tparam VCapacity The capacity.
+ */
+template <class T, std::size_t VCapacity>
+struct sl::graph::take_next_t<sl::graph::fixed_queue<T, VCapacity>>
+	: detail::fixed_capacity_take_next_t<fixed_queue<T, VCapacity>>
+{
+};
+
+/**
+ * \brief Specialization for fixed_stack.
+ * \tparam T The element type.
+ * \tparam VCapacity The capacity.
+ */
+template <class T, std::size_t VCapacity>
+struct sl::graph::take_next_t<sl::graph::fixed_stack<T, VCapacity>>
+	: detail::fixed_capacity_take_next_t<fixed_stack<T, VCapacity>>
+{
+};
+
+/**
+ * \brief Specialization for fixed_priority_queue.
+ * \tparam T The element type.
+ * \tparam VCapacity The capacity.
+ * \tparam TCompare The comparison type.
+ */
+template <class T, std::size_t VCapacity, class TCompare>
+struct sl::graph::take_next_t<sl::graph::fixed_priority_queue<T, VCapacity, TCompare>>
+	: detail::fixed_capacity_take_next_t<fixed_priority_queue<T, VCapacity, TCompare>>
+{
+};
+
+/**
+ * \brief Specialization for fixed_queue.
+ * \tparam T The element type.
+ * \tparam VCapacity The capacity.
+ */
+template <class T, std::size_t VCapacity>
+struct sl::graph::emplace_t<sl::graph::fixed_queue<T, VCapacity>>
+	: detail::fixed_capacity_emplace_t<fixed_queue<T, VCapacity>>
+{
+};
+
+/**
+ * \brief Specialization for fixed_stack.
+ * \tparam T The element type.
+ * \tparam VCapacity The capacity.
+ */
+template <class T, std::size_t VCapacity>
+struct sl::graph::emplace_t<sl::graph::fixed_stack<T, VCapacity>>
+	: detail::fixed_capacity_emplace_t<fixed_stack<T, VCapacity>>
+{
+};
+
+/**
+ * \brief Specialization for fixed_priority_queue.
+ * \tparam T The element type.
+ * \tparam VCapacity The capacity.
+ * \tparam TCompare The comparison type.
+ */
+template <class T, std::size_t VCapacity, class TCompare>
+struct sl::graph::emplace_t<sl::graph::fixed_priority_queue<T, VCapacity, TCompare>>
+	: detail::fixed_capacity_emplace_t<fixed_priority_queue<T, VCapacity, TCompare>>
+{
+};
+
+/** @}*/
+
+#endif
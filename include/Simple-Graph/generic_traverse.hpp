@@ -10,9 +10,18 @@
 
 #include "utility.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <concepts>
+#include <functional>
+#include <optional>
 #include <ranges>
+#include <stop_token>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace sl::graph::detail
 {
@@ -20,101 +29,379 @@ namespace sl::graph::detail
 	concept node_factory_for = std::invocable<T, TNode, node_vertex_t<TNode>>
 								&& std::convertible_to<std::invoke_result_t<T, TNode, node_vertex_t<TNode>>, TNode>;
 
+	template <class T, class TNode>
+	concept node_range_for = std::ranges::input_range<T>
+							&& std::convertible_to<std::ranges::range_reference_t<T>, TNode>;
+
+	template <weight TWeight>
+	using dynamic_cost_state_t = std::tuple<visit_state, TWeight>;
+
+	/*
+	 * The expanders hold the whole state of a traversal and advance it step by step: next() takes the next node from the open
+	 * list and expand(node) discovers the neighbors of that node. Each template argument may either be a value or a reference
+	 * type, thus the expanders may own or borrow their components.
+	 */
+	template <class TNode, class TNodeFactory, class TNeighborSearcher, class TVertexPredicate, class TStateMap, class TOpenList>
+	class uniform_cost_expander
+	{
+	public:
+		using node_t = TNode;
+		using vertex_t = node_vertex_t<TNode>;
+
+		constexpr uniform_cost_expander
+		(
+			TNodeFactory nodeFactory,
+			TNeighborSearcher neighborSearcher,
+			TVertexPredicate vertexPredicate,
+			TStateMap stateMap,
+			TOpenList openList
+		)
+			: m_NodeFactory{ std::forward<TNodeFactory>(nodeFactory) },
+			m_NeighborSearcher{ std::forward<TNeighborSearcher>(neighborSearcher) },
+			m_VertexPredicate{ std::forward<TVertexPredicate>(vertexPredicate) },
+			m_StateMap{ std::forward<TStateMap>(stateMap) },
+			m_OpenList{ std::forward<TOpenList>(openList) }
+		{
+		}
+
+		constexpr void discover(TNode begin)
+		{
+			if (!std::exchange(m_StateMap[begin.vertex], true))
+				emplace(m_OpenList, std::move(begin));
+		}
+
+		[[nodiscard]]
+		constexpr std::optional<TNode> next()
+		{
+			if (detail::empty_helper(m_OpenList))
+				return std::nullopt;
+			return take_next(m_OpenList);
+		}
+
+		constexpr void expand(const TNode& predecessor)
+		{
+			for
+			(
+				auto&& neighbors = std::invoke(m_NeighborSearcher, predecessor.vertex);
+				const vertex_t& cur_vertex
+				: neighbors
+				| std::views::filter([this](const vertex_t& v) { return !std::exchange(m_StateMap[v], true); })
+				| std::views::filter([&](const vertex_t& v) { return std::invoke(m_VertexPredicate, predecessor, v); })
+			)
+			{
+				emplace(m_OpenList, std::invoke(m_NodeFactory, predecessor, cur_vertex));
+			}
+		}
+
+	private:
+		TNodeFactory m_NodeFactory;
+		TNeighborSearcher m_NeighborSearcher;
+		TVertexPredicate m_VertexPredicate;
+		TStateMap m_StateMap;
+		TOpenList m_OpenList;
+	};
+
+	template <class TNode, class TNodeFactory, class TNeighborSearcher, class TVertexPredicate, class TStateMap, class TOpenList>
+	class dynamic_cost_expander
+	{
+	public:
+		using node_t = TNode;
+		using vertex_t = node_vertex_t<TNode>;
+		using weight_t = node_weight_t<TNode>;
+
+		constexpr dynamic_cost_expander
+		(
+			TNodeFactory nodeFactory,
+			TNeighborSearcher neighborSearcher,
+			TVertexPredicate vertexPredicate,
+			TStateMap stateMap,
+			TOpenList openList
+		)
+			: m_NodeFactory{ std::forward<TNodeFactory>(nodeFactory) },
+			m_NeighborSearcher{ std::forward<TNeighborSearcher>(neighborSearcher) },
+			m_VertexPredicate{ std::forward<TVertexPredicate>(vertexPredicate) },
+			m_StateMap{ std::forward<TStateMap>(stateMap) },
+			m_OpenList{ std::forward<TOpenList>(openList) }
+		{
+		}
+
+		constexpr void discover(TNode begin)
+		{
+			auto&& [begin_state, begin_weight] = m_StateMap[begin.vertex];
+			if (begin_state == visit_state::none || static_cast<weight_t>(begin) < begin_weight)
+			{
+				begin_state = visit_state::discovered;
+				begin_weight = static_cast<weight_t>(begin);
+				emplace(m_OpenList, std::move(begin));
+			}
+		}
+
+		// outdated duplicates of already visited vertices are skipped
+		[[nodiscard]]
+		constexpr std::optional<TNode> next()
+		{
+			while (!detail::empty_helper(m_OpenList))
+			{
+				TNode node{ take_next(m_OpenList) };
+				if (visit_state::visited != std::exchange(std::get<0>(m_StateMap[node.vertex]), visit_state::visited))
+					return node;
+			}
+			return std::nullopt;
+		}
+
+		constexpr void expand(const TNode& predecessor)
+		{
+			for (const vertex_t& cur_vertex : std::invoke(m_NeighborSearcher, predecessor.vertex))
+			{
+				relax(predecessor, cur_vertex);
+			}
+		}
+
+		// collects all neighbors first, thus the state slots of the whole batch are in flight before the first one is accessed.
+		// The batch buffer is owned by the caller, thus expanders used in the direct mode do not carry it around.
+		constexpr void expand_prefetched(const TNode& predecessor, std::vector<vertex_t>& batch)
+		{
+			batch.clear();
+			for (const vertex_t& cur_vertex : std::invoke(m_NeighborSearcher, predecessor.vertex))
+			{
+				prefetch(m_StateMap, cur_vertex);
+				batch.emplace_back(cur_vertex);
+			}
+
+			for (const vertex_t& cur_vertex : batch)
+			{
+				relax(predecessor, cur_vertex);
+			}
+		}
+
+		// the neighbor searcher may be wrapped into a std::reference_wrapper, which must be unwrapped for the prefetch_t lookup
+		constexpr void prefetch_adjacency(const TNode& node) const
+		{
+			const std::unwrap_ref_decay_t<TNeighborSearcher>& neighborSearcher = m_NeighborSearcher;
+			prefetch(neighborSearcher, node.vertex);
+		}
+
+	private:
+		TNodeFactory m_NodeFactory;
+		TNeighborSearcher m_NeighborSearcher;
+		TVertexPredicate m_VertexPredicate;
+		TStateMap m_StateMap;
+		TOpenList m_OpenList;
+
+		constexpr void relax(const TNode& predecessor, const vertex_t& cur_vertex)
+		{
+			auto&& [cur_state, cur_weight] = m_StateMap[cur_vertex];
+			if (cur_state == visit_state::visited || !std::invoke(m_VertexPredicate, predecessor, cur_vertex))
+				return;
+
+			TNode current{ std::invoke(m_NodeFactory, predecessor, cur_vertex) };
+			switch (cur_state)
+			{
+			case visit_state::none:
+				cur_state = visit_state::discovered;
+				cur_weight = static_cast<weight_t>(current);
+				emplace(m_OpenList, std::move(current));
+				break;
+
+			case visit_state::discovered:
+				if (current.weight_sum < cur_weight)
+				{
+					cur_weight = static_cast<weight_t>(current);
+					emplace(m_OpenList, std::move(current));
+				}
+				break;
+			}
+		}
+	};
+
+	/*
+	 * Checks the provided stop token once per interval invocations, thus the atomic access does not happen for each single
+	 * node. Default constructed checkers never stop. The checker only refers to the token, which is owned by the search_params
+	 * and must thus outlive the checker. Tokens, which can never be stopped, are dropped immediately. This keeps the checker a
+	 * trivial type, thus traversals without a token never touch any ``std::stop_token`` and stay usable in constant expressions.
+	 */
+	class stop_checker
+	{
+	public:
+		constexpr stop_checker() = default;
+
+		constexpr stop_checker(const std::optional<std::stop_token>& stopToken, std::size_t interval) noexcept
+			: m_StopToken{ stopToken && stopToken->stop_possible() ? &*stopToken : nullptr },
+			m_Interval{ std::max<std::size_t>(interval, 1) },
+			m_Countdown{ m_Interval }
+		{
+		}
+
+		[[nodiscard]]
+		constexpr bool shall_stop() noexcept
+		{
+			if (!m_StopToken || --m_Countdown != 0)
+				return false;
+
+			m_Countdown = m_Interval;
+			return m_StopToken->stop_requested();
+		}
+
+	private:
+		const std::stop_token* m_StopToken{};
+		std::size_t m_Interval{ 1 };
+		std::size_t m_Countdown{ 1 };
+	};
+
+	template <template <class...> class TExpander, class TNode, class... TArgs>
+	[[nodiscard]]
+	constexpr TExpander<TNode, TArgs...> make_expander(TArgs&&... args)
+	{
+		return TExpander<TNode, TArgs...>{ std::forward<TArgs>(args)... };
+	}
+
 	template <class TNode, vertex_descriptor TVertex = node_vertex_t<TNode>, weight TWeight = node_weight_t<TNode>>
-	void uniform_cost_traverse
+	constexpr void uniform_cost_traverse
 	(
 		node_factory_for<TNode> auto&& nodeFactory,
-		TNode begin,
+		node_range_for<TNode> auto&& begins,
 		neighbor_searcher_for<TVertex> auto&& neighborSearcher,
 		node_callback<TNode> auto&& callback,
 		vertex_predicate_for<TNode> auto&& vertexPredicate,
 		state_map_for<node_vertex_t<TNode>, bool> auto&& stateMap,
-		open_list_for<TNode> auto&& openList
+		open_list_for<TNode> auto&& openList,
+		stop_checker stopChecker = {}
 	)
 	{
 		assert(detail::empty_helper(openList));
 
-		stateMap[begin.vertex] = true;
-		emplace(openList, std::move(begin));
+		auto expander = make_expander<uniform_cost_expander, TNode>
+		(
+			std::forward<decltype(nodeFactory)>(nodeFactory),
+			std::forward<decltype(neighborSearcher)>(neighborSearcher),
+			std::forward<decltype(vertexPredicate)>(vertexPredicate),
+			std::forward<decltype(stateMap)>(stateMap),
+			std::forward<decltype(openList)>(openList)
+		);
 
-		while (!detail::empty_helper(openList))
+		for (TNode begin : begins)
 		{
-			TNode predecessor{ take_next(openList) };
+			expander.discover(std::move(begin));
+		}
 
-			if (detail::shall_interrupt(callback, predecessor))
+		while (const std::optional<TNode> predecessor{ expander.next() })
+		{
+			if (stopChecker.shall_stop() || detail::shall_interrupt(callback, *predecessor))
 				return;
 
-			for
-			(
-				auto&& neighbors = std::invoke(neighborSearcher, predecessor.vertex);
-				const TVertex& cur_vertex
-				: neighbors
-				| std::views::filter([&stateMap](const TVertex& v) { return !std::exchange(stateMap[v], true); })
-				| std::views::filter([&](const TVertex& v) { return std::invoke(vertexPredicate, predecessor, v); })
-			)
-			{
-				emplace(openList, std::invoke(nodeFactory, predecessor, cur_vertex));
-			}
+			expander.expand(*predecessor);
 		}
 	}
 
-	template <weight TWeight>
-	using dynamic_cost_state_t = std::tuple<visit_state, TWeight>;
-
 	template <class TNode, vertex_descriptor TVertex = node_vertex_t<TNode>, weight TWeight = node_weight_t<TNode>>
-	void dynamic_cost_traverse
+	constexpr void uniform_cost_traverse
 	(
 		node_factory_for<TNode> auto&& nodeFactory,
 		TNode begin,
 		neighbor_searcher_for<TVertex> auto&& neighborSearcher,
 		node_callback<TNode> auto&& callback,
 		vertex_predicate_for<TNode> auto&& vertexPredicate,
-		state_map_for<TVertex, dynamic_cost_state_t<TWeight>> auto&& stateMap,
-		open_list_for<TNode> auto&& openList
+		state_map_for<node_vertex_t<TNode>, bool> auto&& stateMap,
+		open_list_for<TNode> auto&& openList,
+		stop_checker stopChecker = {}
 	)
 	{
-		using state_t = dynamic_cost_state_t<TWeight>;
+		uniform_cost_traverse<TNode>
+		(
+			std::forward<decltype(nodeFactory)>(nodeFactory),
+			std::views::single(std::move(begin)),
+			std::forward<decltype(neighborSearcher)>(neighborSearcher),
+			std::forward<decltype(callback)>(callback),
+			std::forward<decltype(vertexPredicate)>(vertexPredicate),
+			std::forward<decltype(stateMap)>(stateMap),
+			std::forward<decltype(openList)>(openList),
+			std::move(stopChecker)
+		);
+	}
 
+	template <class TNode, vertex_descriptor TVertex = node_vertex_t<TNode>, weight TWeight = node_weight_t<TNode>>
+	constexpr void dynamic_cost_traverse
+	(
+		node_factory_for<TNode> auto&& nodeFactory,
+		node_range_for<TNode> auto&& begins,
+		neighbor_searcher_for<TVertex> auto&& neighborSearcher,
+		node_callback<TNode> auto&& callback,
+		vertex_predicate_for<TNode> auto&& vertexPredicate,
+		state_map_for<TVertex, dynamic_cost_state_t<TWeight>> auto&& stateMap,
+		open_list_for<TNode> auto&& openList,
+		stop_checker stopChecker = {},
+		expansion_mode expansionMode = expansion_mode::direct
+	)
+	{
 		assert(detail::empty_helper(openList));
 
-		stateMap[begin.vertex] = { visit_state::discovered, TWeight{} };
-		emplace(openList, std::move(begin));
+		auto expander = make_expander<dynamic_cost_expander, TNode>
+		(
+			std::forward<decltype(nodeFactory)>(nodeFactory),
+			std::forward<decltype(neighborSearcher)>(neighborSearcher),
+			std::forward<decltype(vertexPredicate)>(vertexPredicate),
+			std::forward<decltype(stateMap)>(stateMap),
+			std::forward<decltype(openList)>(openList)
+		);
 
-		while (!detail::empty_helper(openList))
+		for (TNode begin : begins)
 		{
-			TNode predecessor{ take_next(openList) };
-			if (visit_state::visited == std::exchange(std::get<0>(stateMap[predecessor.vertex]), visit_state::visited))
-				continue;
+			expander.discover(std::move(begin));
+		}
 
-			if (detail::shall_interrupt(callback, predecessor))
-				return;
+		if (expansionMode == expansion_mode::prefetched)
+		{
+			// the batch buffer only exists in this mode, thus the direct mode neither allocates nor requires a constexpr std::vector
+			std::vector<node_vertex_t<TNode>> batch{};
+			while (const std::optional<TNode> predecessor{ expander.next() })
+			{
+				// overlaps the adjacency fetch with the stop check and the callback invocation
+				expander.prefetch_adjacency(*predecessor);
+				if (stopChecker.shall_stop() || detail::shall_interrupt(callback, *predecessor))
+					return;
 
-			for (const TVertex& cur_vertex : std::invoke(neighborSearcher, predecessor.vertex))
+				expander.expand_prefetched(*predecessor, batch);
+			}
+		}
+		else
+		{
+			while (const std::optional<TNode> predecessor{ expander.next() })
 			{
-				auto&& [cur_state, cur_weight] = stateMap[cur_vertex];
-				if (cur_state == visit_state::visited || !std::invoke(vertexPredicate, predecessor, cur_vertex))
-					continue;
+				if (stopChecker.shall_stop() || detail::shall_interrupt(callback, *predecessor))
+					return;
 
-				TNode current{ std::invoke(nodeFactory, predecessor, cur_vertex) };
-				switch (cur_state)
-				{
-				case visit_state::none:
-					cur_state = visit_state::discovered;
-					cur_weight = static_cast<TWeight>(current);
-					emplace(openList, std::move(current));
-					break;
-
-				case visit_state::discovered:
-					if (current.weight_sum < cur_weight)
-					{
-						cur_weight = static_cast<TWeight>(current);
-						emplace(openList, std::move(current));
-					}
-					break;
-				}
+				expander.expand(*predecessor);
 			}
 		}
 	}
+
+	template <class TNode, vertex_descriptor TVertex = node_vertex_t<TNode>, weight TWeight = node_weight_t<TNode>>
+	constexpr void dynamic_cost_traverse
+	(
+		node_factory_for<TNode> auto&& nodeFactory,
+		TNode begin,
+		neighbor_searcher_for<TVertex> auto&& neighborSearcher,
+		node_callback<TNode> auto&& callback,
+		vertex_predicate_for<TNode> auto&& vertexPredicate,
+		state_map_for<TVertex, dynamic_cost_state_t<TWeight>> auto&& stateMap,
+		open_list_for<TNode> auto&& openList,
+		stop_checker stopChecker = {},
+		expansion_mode expansionMode = expansion_mode::direct
+	)
+	{
+		dynamic_cost_traverse<TNode>
+		(
+			std::forward<decltype(nodeFactory)>(nodeFactory),
+			std::views::single(std::move(begin)),
+			std::forward<decltype(neighborSearcher)>(neighborSearcher),
+			std::forward<decltype(callback)>(callback),
+			std::forward<decltype(vertexPredicate)>(vertexPredicate),
+			std::forward<decltype(stateMap)>(stateMap),
+			std::forward<decltype(openList)>(openList),
+			std::move(stopChecker),
+			expansionMode
+		);
+	}
 }
 
 #endif
@@ -0,0 +1,642 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_HPA_HPP
+#define SIMPLE_GRAPH_HPA_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "dijkstra.hpp"
+#include "parallel_helper.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::hpa
+{
+	/** \addtogroup hpa
+	* @{
+	* \brief Provides hierarchical path-finding (HPA*) for large grids.
+	* \details The grid is divided into square clusters. Each contiguous segment of edges crossing the border between two clusters
+	* is represented by one or two entrances, and the distances between all entrances of the same cluster are precomputed.
+	* Queries search the resulting abstract graph with astar and refine only the clusters on the abstract path. The resulting
+	* paths are near-optimal.
+	* The grid cells are dense vertex ids in row-major order, thus the cell at ``(x, y)`` is denoted by ``y * width + x``.
+	*/
+
+	/**
+	 * \brief The params of the abstract graph.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 */
+	template <
+		std::integral TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator>
+	struct build_params
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief The width of the grid.
+		 */
+		TVertex width{};
+
+		/**
+		 * \brief The height of the grid.
+		 */
+		TVertex height{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 * \attention Each neighbor must be located in the same or an adjacent cluster. The neighbor searcher will be invoked
+		 * concurrently.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero. The weight calculator will be invoked concurrently.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The width and height of each cluster.
+		 */
+		TVertex clusterSize{ 16 };
+
+		/**
+		 * \brief The amount of threads to be used. If set to 0, ``std::thread::hardware_concurrency`` is used.
+		 */
+		std::size_t threadCount{ 1 };
+	};
+
+	/**
+	 * \brief The abstract graph.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \details The neighbor searcher and weight calculator are kept, as they are required for the refinement of the paths and
+	 * for rebuilding clusters.
+	 */
+	template <
+		std::integral TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator>
+	class graph_t
+	{
+	public:
+		/**
+		 * \brief Alias for the params type.
+		 */
+		using params_t = build_params<TVertex, TNeighborSearcher, TWeightCalculator>;
+
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = typename params_t::weight_t;
+
+		/**
+		 * \brief Constructor, which builds the abstract graph of all clusters in parallel.
+		 * \param params The build_params object.
+		 */
+		explicit graph_t(params_t params)
+			: m_Params{ std::move(params) },
+			m_ClustersX{ (m_Params.width + m_Params.clusterSize - 1) / m_Params.clusterSize },
+			m_ClustersY{ (m_Params.height + m_Params.clusterSize - 1) / m_Params.clusterSize },
+			m_Crossings(cluster_count()),
+			m_Clusters(cluster_count())
+		{
+			assert(TVertex{} < m_Params.clusterSize && "cluster size must be greater than zero.");
+
+			std::vector<std::size_t> clusters(cluster_count());
+			for (std::size_t i{ 0 }; i < std::size(clusters); ++i)
+			{
+				clusters[i] = i;
+			}
+			build_clusters(clusters, clusters);
+		}
+
+		/**
+		 * \brief Returns the amount of clusters.
+		 */
+		[[nodiscard]]
+		std::size_t cluster_count() const noexcept
+		{
+			return static_cast<std::size_t>(m_ClustersX * m_ClustersY);
+		}
+
+		/**
+		 * \brief Returns the index of the cluster, which contains the given cell.
+		 */
+		[[nodiscard]]
+		std::size_t cluster_of(const TVertex& v) const noexcept
+		{
+			assert(TVertex{} <= v && v < m_Params.width * m_Params.height && "vertex is out of range.");
+			const TVertex x{ v % m_Params.width };
+			const TVertex y{ v / m_Params.width };
+			return static_cast<std::size_t>((y / m_Params.clusterSize) * m_ClustersX + x / m_Params.clusterSize);
+		}
+
+		/**
+		 * \brief Returns the entrance cells of the given cluster.
+		 */
+		[[nodiscard]]
+		std::span<const TVertex> entrances(std::size_t cluster) const noexcept
+		{
+			assert(cluster < cluster_count());
+			return m_Clusters[cluster].entrances;
+		}
+
+		/**
+		 * \brief Rebuilds the abstract graph of the given cluster. This must be called, whenever the weights or neighbors of any cell
+		 * of the cluster changed.
+		 * \param cluster The index of the cluster.
+		 * \details The entrances on the borders to all adjacent clusters are recomputed, thus the adjacent clusters are rebuilt, too.
+		 */
+		void rebuild_cluster(std::size_t cluster)
+		{
+			assert(cluster < cluster_count());
+
+			std::vector<std::size_t> affected{ adjacent_clusters(cluster) };
+			affected.emplace_back(cluster);
+			build_clusters(affected, affected);
+		}
+
+		/**
+		 * \brief Searches for a near-optimal path between both cells.
+		 * \param begin The begin cell.
+		 * \param destination The destination cell.
+		 * \param heuristic The heuristic, which estimates the remaining cost from a cell to the destination.
+		 * \return Returns the path in reversed order (destination first), or ``std::nullopt`` if destination is unreachable.
+		 */
+		template <astar::compatible_heuristic_for<TVertex, TWeightCalculator> THeuristic = constant_t<0>>
+		[[nodiscard]]
+		std::optional<std::vector<TVertex>> find_path(const TVertex& begin, const TVertex& destination, THeuristic heuristic = {}) const
+		{
+			if (begin == destination)
+				return std::vector{ begin };
+
+			const std::size_t beginCluster{ cluster_of(begin) };
+			const std::size_t destinationCluster{ cluster_of(destination) };
+
+			// connects the begin and destination cells to the entrances of their clusters
+			std::vector<edge_t> beginEdges{};
+			cluster_distances
+			(
+				begin,
+				beginCluster,
+				[&](const TVertex& v, const weight_t& distance)
+				{
+					if (v != begin && (v == destination || is_entrance(beginCluster, v)))
+					{
+						beginEdges.emplace_back(edge_t{ v, distance });
+					}
+				}
+			);
+
+			std::unordered_map<TVertex, weight_t> destinationEdges{};
+			for (const TVertex& entrance : m_Clusters[destinationCluster].entrances)
+			{
+				cluster_distances
+				(
+					entrance,
+					destinationCluster,
+					[&](const TVertex& v, const weight_t& distance)
+					{
+						if (v == destination)
+						{
+							destinationEdges.emplace(entrance, distance);
+							return true;
+						}
+						return false;
+					}
+				);
+			}
+
+			abstract_edge_cache cache{ this, begin, destination, &beginEdges, &destinationEdges };
+			const std::optional abstractPath = graph::find_path
+			(
+				astar::search_params
+				{
+					.begin = begin,
+					.neighborSearcher = [&](const TVertex& v)
+					{
+						return cache.edges(v) | std::views::transform(&edge_t::vertex);
+					},
+					.weightCalculator = [&](const TVertex& from, const TVertex& to)
+					{
+						return cache.weight(from, to);
+					},
+					.heuristic = std::ref(heuristic),
+					.callback = [&](const auto& node) { return node.vertex == destination; },
+					.stateMap = std::unordered_map<TVertex, astar::state_t<weight_t>>{}
+				},
+				std::unordered_map<TVertex, std::optional<TVertex>>{}
+			);
+
+			if (!abstractPath)
+				return std::nullopt;
+
+			// refines each intra cluster edge; crossing edges connect adjacent cells
+			std::vector<TVertex> path{ abstractPath->front() };
+			for (std::size_t i{ 1 }; i < std::size(*abstractPath); ++i)
+			{
+				const TVertex& to = (*abstractPath)[i - 1];
+				const TVertex& from = (*abstractPath)[i];
+				if (const std::size_t cluster{ cluster_of(from) }; cluster == cluster_of(to))
+				{
+					std::optional subPath = cluster_path(from, to, cluster);
+					assert(subPath && "abstract edge is not refinable.");
+					path.insert(std::end(path), std::begin(*subPath) + 1, std::end(*subPath));
+				}
+				else
+				{
+					path.emplace_back(from);
+				}
+			}
+			return { std::move(path) };
+		}
+
+	private:
+		struct edge_t
+		{
+			TVertex vertex{};
+			weight_t weight{};
+		};
+
+		struct crossing_t
+		{
+			TVertex from{};
+			TVertex to{};
+			weight_t weight{};
+		};
+
+		struct cluster_t
+		{
+			// sorted
+			std::vector<TVertex> entrances{};
+
+			// the intra cluster edges of each entrance
+			std::vector<std::vector<edge_t>> edges{};
+		};
+
+		// the abstract search queries the edges once for the neighbor search and once per weight calculation
+		struct abstract_edge_cache
+		{
+			const graph_t* graph{};
+			TVertex begin{};
+			TVertex destination{};
+			const std::vector<edge_t>* beginEdges{};
+			const std::unordered_map<TVertex, weight_t>* destinationEdges{};
+			std::optional<TVertex> cachedVertex{};
+			std::vector<edge_t> cachedEdges{};
+
+			const std::vector<edge_t>& edges(const TVertex& v)
+			{
+				if (cachedVertex != v)
+				{
+					cachedVertex = v;
+					cachedEdges.clear();
+					if (v == begin)
+					{
+						cachedEdges = *beginEdges;
+					}
+
+					graph->append_abstract_edges(v, cachedEdges);
+
+					if (const auto itr = destinationEdges->find(v); itr != std::end(*destinationEdges))
+					{
+						cachedEdges.emplace_back(edge_t{ destination, itr->second });
+					}
+				}
+				return cachedEdges;
+			}
+
+			weight_t weight(const TVertex& from, const TVertex& to)
+			{
+				std::optional<weight_t> result{};
+				for (const edge_t& edge : edges(from))
+				{
+					if (edge.vertex == to && (!result || edge.weight < *result))
+					{
+						result = edge.weight;
+					}
+				}
+				assert(result && "edge does not exist.");
+				return *result;
+			}
+		};
+
+		params_t m_Params;
+		TVertex m_ClustersX;
+		TVertex m_ClustersY;
+
+		// the selected edges leaving each cluster
+		std::vector<std::vector<crossing_t>> m_Crossings;
+		std::vector<cluster_t> m_Clusters;
+
+		[[nodiscard]]
+		static constexpr bool are_adjacent(const TVertex& lhs, const TVertex& rhs, const TVertex& width) noexcept
+		{
+			const auto delta = [](const TVertex& a, const TVertex& b) { return a < b ? b - a : a - b; };
+			return delta(lhs % width, rhs % width) + delta(lhs / width, rhs / width) == 1;
+		}
+
+		[[nodiscard]]
+		std::vector<std::size_t> adjacent_clusters(std::size_t cluster) const
+		{
+			const auto clusterX{ static_cast<TVertex>(cluster % static_cast<std::size_t>(m_ClustersX)) };
+			const auto clusterY{ static_cast<TVertex>(cluster / static_cast<std::size_t>(m_ClustersX)) };
+
+			std::vector<std::size_t> result{};
+			for (TVertex y{ clusterY == 0 ? clusterY : clusterY - 1 }; y <= clusterY + 1 && y < m_ClustersY; ++y)
+			{
+				for (TVertex x{ clusterX == 0 ? clusterX : clusterX - 1 }; x <= clusterX + 1 && x < m_ClustersX; ++x)
+				{
+					if (x != clusterX || y != clusterY)
+					{
+						result.emplace_back(static_cast<std::size_t>(y * m_ClustersX + x));
+					}
+				}
+			}
+			return result;
+		}
+
+		template <class TFunc>
+		void for_each_cell(std::size_t cluster, TFunc func) const
+		{
+			const TVertex beginX{ static_cast<TVertex>(cluster % static_cast<std::size_t>(m_ClustersX)) * m_Params.clusterSize };
+			const TVertex beginY{ static_cast<TVertex>(cluster / static_cast<std::size_t>(m_ClustersX)) * m_Params.clusterSize };
+			const TVertex endX{ std::min<TVertex>(beginX + m_Params.clusterSize, m_Params.width) };
+			const TVertex endY{ std::min<TVertex>(beginY + m_Params.clusterSize, m_Params.height) };
+			for (TVertex y{ beginY }; y < endY; ++y)
+			{
+				for (TVertex x{ beginX }; x < endX; ++x)
+				{
+					std::invoke(func, static_cast<TVertex>(y * m_Params.width + x));
+				}
+			}
+		}
+
+		[[nodiscard]]
+		bool is_entrance(std::size_t cluster, const TVertex& v) const noexcept
+		{
+			return std::ranges::binary_search(m_Clusters[cluster].entrances, v);
+		}
+
+		void append_abstract_edges(const TVertex& v, std::vector<edge_t>& edges) const
+		{
+			const std::size_t cluster{ cluster_of(v) };
+			const cluster_t& curCluster = m_Clusters[cluster];
+			if (const auto itr = std::ranges::lower_bound(curCluster.entrances, v); itr != std::end(curCluster.entrances) && *itr == v)
+			{
+				const auto& intraEdges = curCluster.edges[static_cast<std::size_t>(std::distance(std::begin(curCluster.entrances), itr))];
+				edges.insert(std::end(edges), std::begin(intraEdges), std::end(intraEdges));
+				for (const crossing_t& crossing : m_Crossings[cluster])
+				{
+					if (crossing.from == v)
+					{
+						edges.emplace_back(edge_t{ crossing.to, crossing.weight });
+					}
+				}
+			}
+		}
+
+		// runs a dijkstra, which never leaves the cluster; the callback may return true to stop the search
+		template <class TCallback>
+		void cluster_distances(const TVertex& begin, std::size_t cluster, TCallback callback) const
+		{
+			traverse
+			(
+				dijkstra::search_params
+				{
+					.begin = begin,
+					.neighborSearcher = std::ref(m_Params.neighborSearcher),
+					.weightCalculator = std::ref(m_Params.weightCalculator),
+					.callback = [&](const auto& node) { return detail::shall_interrupt(callback, node.vertex, node.weight_sum); },
+					.vertexPredicate = [&](const auto&, const TVertex& v) { return cluster_of(v) == cluster; },
+					.stateMap = std::unordered_map<TVertex, dijkstra::state_t<weight_t>>{}
+				}
+			);
+		}
+
+		// the path is in reversed order
+		[[nodiscard]]
+		std::optional<std::vector<TVertex>> cluster_path(const TVertex& begin, const TVertex& destination, std::size_t cluster) const
+		{
+			return graph::find_path
+			(
+				dijkstra::search_params
+				{
+					.begin = begin,
+					.neighborSearcher = std::ref(m_Params.neighborSearcher),
+					.weightCalculator = std::ref(m_Params.weightCalculator),
+					.callback = [&](const auto& node) { return node.vertex == destination; },
+					.vertexPredicate = [&](const auto&, const TVertex& v) { return cluster_of(v) == cluster; },
+					.stateMap = std::unordered_map<TVertex, dijkstra::state_t<weight_t>>{}
+				},
+				std::unordered_map<TVertex, std::optional<TVertex>>{}
+			);
+		}
+
+		// each contiguous segment of crossing edges towards the same cluster is represented by its middle edge, or by both ends
+		// if it's long
+		void build_crossings(std::size_t cluster)
+		{
+			std::vector<std::tuple<std::size_t, crossing_t>> candidates{};
+			for_each_cell
+			(
+				cluster,
+				[&](const TVertex& v)
+				{
+					for (const TVertex& cur_vertex : std::invoke(m_Params.neighborSearcher, v))
+					{
+						if (const std::size_t cur_cluster{ cluster_of(cur_vertex) }; cur_cluster != cluster)
+						{
+							candidates.emplace_back(cur_cluster, crossing_t{ v, cur_vertex, std::invoke(m_Params.weightCalculator, v, cur_vertex) });
+						}
+					}
+				}
+			);
+
+			std::ranges::sort
+			(
+				candidates,
+				std::ranges::less{},
+				[](const auto& candidate)
+				{
+					const auto& [targetCluster, crossing] = candidate;
+					return std::tuple{ targetCluster, crossing.from, crossing.to };
+				}
+			);
+
+			constexpr std::size_t longSegment{ 6 };
+			std::vector<crossing_t>& crossings = m_Crossings[cluster];
+			crossings.clear();
+			for (std::size_t segmentBegin{ 0 }; segmentBegin < std::size(candidates);)
+			{
+				std::size_t segmentEnd{ segmentBegin + 1 };
+				for (; segmentEnd < std::size(candidates); ++segmentEnd)
+				{
+					const auto& [prevCluster, prev] = candidates[segmentEnd - 1];
+					const auto& [curCluster, cur] = candidates[segmentEnd];
+					if (prevCluster != curCluster
+						|| !are_adjacent(prev.from, cur.from, m_Params.width)
+						|| !are_adjacent(prev.to, cur.to, m_Params.width))
+						break;
+				}
+
+				if (longSegment <= segmentEnd - segmentBegin)
+				{
+					crossings.emplace_back(std::get<1>(candidates[segmentBegin]));
+					crossings.emplace_back(std::get<1>(candidates[segmentEnd - 1]));
+				}
+				else
+				{
+					crossings.emplace_back(std::get<1>(candidates[(segmentBegin + segmentEnd) / 2]));
+				}
+				segmentBegin = segmentEnd;
+			}
+		}
+
+		void build_intra_edges(std::size_t cluster)
+		{
+			cluster_t& curCluster = m_Clusters[cluster];
+			curCluster.entrances.clear();
+			for (const crossing_t& crossing : m_Crossings[cluster])
+			{
+				curCluster.entrances.emplace_back(crossing.from);
+			}
+			for (const std::size_t adjacent : adjacent_clusters(cluster))
+			{
+				for (const crossing_t& crossing : m_Crossings[adjacent])
+				{
+					if (cluster_of(crossing.to) == cluster)
+					{
+						curCluster.entrances.emplace_back(crossing.to);
+					}
+				}
+			}
+			std::ranges::sort(curCluster.entrances);
+			const auto [first, last] = std::ranges::unique(curCluster.entrances);
+			curCluster.entrances.erase(first, last);
+
+			curCluster.edges.assign(std::size(curCluster.entrances), {});
+			for (std::size_t i{ 0 }; i < std::size(curCluster.entrances); ++i)
+			{
+				const TVertex& entrance = curCluster.entrances[i];
+				cluster_distances
+				(
+					entrance,
+					cluster,
+					[&](const TVertex& v, const weight_t& distance)
+					{
+						if (v != entrance && is_entrance(cluster, v))
+						{
+							curCluster.edges[i].emplace_back(edge_t{ v, distance });
+						}
+					}
+				);
+			}
+		}
+
+		void build_clusters(const std::vector<std::size_t>& crossingClusters, const std::vector<std::size_t>& intraClusters)
+		{
+			const std::size_t threadCount{ detail::resolve_thread_count(m_Params.threadCount) };
+			detail::parallel_for(threadCount, std::size(crossingClusters), [&](const std::size_t i) { build_crossings(crossingClusters[i]); });
+			detail::parallel_for(threadCount, std::size(intraClusters), [&](const std::size_t i) { build_intra_edges(intraClusters[i]); });
+		}
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Builds the abstract graph of the given grid.
+	 * \tparam TArgs Template arguments for the build_params.
+	 * \param params The build_params object.
+	 * \return Returns the abstract graph.
+	 * \ingroup hpa
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	hpa::graph_t<TArgs...> build_abstract_graph(hpa::build_params<TArgs...> params)
+	{
+		return hpa::graph_t<TArgs...>{ std::move(params) };
+	}
+
+	/**
+	 * \brief Searches for a near-optimal path between both cells.
+	 * \tparam TArgs Template arguments for the graph_t.
+	 * \tparam THeuristic The heuristic type.
+	 * \param graph The abstract graph.
+	 * \param begin The begin cell.
+	 * \param destination The destination cell.
+	 * \param heuristic The heuristic, which estimates the remaining cost from a cell to the destination.
+	 * \return Returns the path in reversed order (destination first), or ``std::nullopt`` if destination is unreachable.
+	 * \ingroup hpa
+	 */
+	template <class... TArgs, class THeuristic = constant_t<0>>
+	[[nodiscard]]
+	std::optional<std::vector<typename hpa::graph_t<TArgs...>::vertex_t>> find_path
+	(
+		const hpa::graph_t<TArgs...>& graph,
+		const typename hpa::graph_t<TArgs...>::vertex_t& begin,
+		const typename hpa::graph_t<TArgs...>::vertex_t& destination,
+		THeuristic heuristic = {}
+	)
+	{
+		return graph.find_path(begin, destination, std::move(heuristic));
+	}
+}
+
+#endif
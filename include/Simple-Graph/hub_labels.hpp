@@ -0,0 +1,537 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_HUB_LABELS_HPP
+#define SIMPLE_GRAPH_HUB_LABELS_HPP
+
+#pragma once
+
+#include "csr_graph.hpp"
+#include "parallel_helper.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace sl::graph::detail
+{
+	// returns the least sum of distances over all shared hubs, or infinity if there is none
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	TWeight hub_label_intersect
+	(
+		std::span<const TVertex> lhsHubs,
+		std::span<const TWeight> lhsDistances,
+		std::span<const TVertex> rhsHubs,
+		std::span<const TWeight> rhsDistances
+	) noexcept
+	{
+		TWeight best{ std::numeric_limits<TWeight>::max() };
+		std::size_t i{ 0 };
+		std::size_t j{ 0 };
+
+#ifdef __AVX2__
+		// compares one lhs hub against a block of eight rhs hubs at once; as hubs are unique and sorted, the lhs hub can only
+		// match within the current block, if it's not greater than the last hub of that block
+		if constexpr (sizeof(TVertex) == sizeof(std::int32_t))
+		{
+			while (i < std::size(lhsHubs) && j + 8 <= std::size(rhsHubs))
+			{
+				const __m256i block{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(std::data(rhsHubs) + j)) };
+				const __m256i needle{ _mm256_set1_epi32(static_cast<std::int32_t>(lhsHubs[i])) };
+				if (const auto mask{ static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(needle, block)))) };
+					mask != 0)
+				{
+					best = std::min<TWeight>(best, lhsDistances[i] + rhsDistances[j + static_cast<std::size_t>(std::countr_zero(mask))]);
+				}
+
+				if (lhsHubs[i] <= rhsHubs[j + 7])
+					++i;
+				else
+					j += 8;
+			}
+		}
+#endif
+
+		while (i < std::size(lhsHubs) && j < std::size(rhsHubs))
+		{
+			if (lhsHubs[i] < rhsHubs[j])
+			{
+				++i;
+			}
+			else if (rhsHubs[j] < lhsHubs[i])
+			{
+				++j;
+			}
+			else
+			{
+				best = std::min<TWeight>(best, lhsDistances[i] + rhsDistances[j]);
+				++i;
+				++j;
+			}
+		}
+		return best;
+	}
+}
+
+namespace sl::graph::hub_labels
+{
+	/** \addtogroup hub_labels
+	* @{
+	* \brief Provides a hub labeling distance oracle.
+	* \details Each vertex v stores an out-label, which contains hubs reachable from v, and an in-label, which contains hubs
+	* reaching v, each with the exact distance. The labels are built via pruned dijkstra searches (pruned landmark labeling), thus
+	* the distance between two arbitrary vertices is the minimum over all hubs shared by the out-label of the begin and the in-label
+	* of the destination. The quality of the labels depends on the order, in which the hubs are processed; important vertices (e.g.
+	* vertices on many shortest paths) should come first.
+	* Hub labels operate on graphs with dense vertex ids, thus each vertex must be an integral value in the range ``[0, vertexCount)``.
+	*/
+
+	/**
+	 * \brief The precomputed labels.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \details All labels are stored in flat arrays, where the entries of each label are sorted by hub rank. The hub ranks and
+	 * distances are stored in separate arrays, thus intersecting two labels only touches the hub ranks until a match is found.
+	 */
+	template <std::integral TVertex, weight TWeight>
+	class labels_t
+	{
+	public:
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Denotes unreachable vertices.
+		 */
+		static constexpr TWeight infinity{ std::numeric_limits<TWeight>::max() };
+
+		/**
+		 * \brief Flat storage of one label direction.
+		 */
+		struct storage_t
+		{
+			/**
+			 * \brief The entry range of each vertex. The entries of vertex v are stored at ``[offsets[v], offsets[v + 1])``.
+			 */
+			std::vector<std::size_t> offsets{ 0 };
+
+			/**
+			 * \brief The hub rank of each entry.
+			 */
+			std::vector<TVertex> hubs{};
+
+			/**
+			 * \brief The distance of each entry.
+			 */
+			std::vector<TWeight> distances{};
+		};
+
+		/**
+		 * \brief Constructor.
+		 * \param order The hubs in processing order, thus ``order[rank]`` is the hub with the given rank.
+		 * \param outLabels The out-labels; each distance is the distance from the vertex to the hub.
+		 * \param inLabels The in-labels; each distance is the distance from the hub to the vertex.
+		 */
+		labels_t(std::vector<TVertex> order, storage_t outLabels, storage_t inLabels) noexcept
+			: m_Order{ std::move(order) },
+			m_OutLabels{ std::move(outLabels) },
+			m_InLabels{ std::move(inLabels) }
+		{
+			assert(std::size(m_OutLabels.offsets) == std::size(m_Order) + 1);
+			assert(std::size(m_InLabels.offsets) == std::size(m_Order) + 1);
+		}
+
+		/**
+		 * \brief Returns the amount of vertices.
+		 */
+		[[nodiscard]]
+		std::size_t vertex_count() const noexcept
+		{
+			return std::size(m_Order);
+		}
+
+		/**
+		 * \brief Returns the total amount of stored entries of both directions.
+		 */
+		[[nodiscard]]
+		std::size_t entry_count() const noexcept
+		{
+			return std::size(m_OutLabels.hubs) + std::size(m_InLabels.hubs);
+		}
+
+		/**
+		 * \brief Returns the hub with the given rank.
+		 */
+		[[nodiscard]]
+		const TVertex& hub(const TVertex& rank) const noexcept
+		{
+			return m_Order[index(rank)];
+		}
+
+		/**
+		 * \brief Returns the hub ranks of the out-label of the vertex.
+		 */
+		[[nodiscard]]
+		std::span<const TVertex> out_hubs(const TVertex& v) const noexcept
+		{
+			return entries(m_OutLabels.hubs, m_OutLabels.offsets, v);
+		}
+
+		/**
+		 * \brief Returns the distances of the out-label of the vertex.
+		 */
+		[[nodiscard]]
+		std::span<const TWeight> out_distances(const TVertex& v) const noexcept
+		{
+			return entries(m_OutLabels.distances, m_OutLabels.offsets, v);
+		}
+
+		/**
+		 * \brief Returns the hub ranks of the in-label of the vertex.
+		 */
+		[[nodiscard]]
+		std::span<const TVertex> in_hubs(const TVertex& v) const noexcept
+		{
+			return entries(m_InLabels.hubs, m_InLabels.offsets, v);
+		}
+
+		/**
+		 * \brief Returns the distances of the in-label of the vertex.
+		 */
+		[[nodiscard]]
+		std::span<const TWeight> in_distances(const TVertex& v) const noexcept
+		{
+			return entries(m_InLabels.distances, m_InLabels.offsets, v);
+		}
+
+		/**
+		 * \brief Returns the distance from the begin to the destination, or ``std::nullopt`` if unreachable.
+		 */
+		[[nodiscard]]
+		std::optional<TWeight> distance(const TVertex& begin, const TVertex& destination) const noexcept
+		{
+			const TWeight weightSum
+			{
+				detail::hub_label_intersect<TVertex, TWeight>(out_hubs(begin), out_distances(begin), in_hubs(destination), in_distances(destination))
+			};
+			if (weightSum == infinity)
+				return std::nullopt;
+			return weightSum;
+		}
+
+	private:
+		std::vector<TVertex> m_Order;
+		storage_t m_OutLabels;
+		storage_t m_InLabels;
+
+		[[nodiscard]]
+		static constexpr std::size_t index(const TVertex& v) noexcept
+		{
+			return static_cast<std::size_t>(v);
+		}
+
+		template <class T>
+		[[nodiscard]]
+		static std::span<const T> entries(const std::vector<T>& values, const std::vector<std::size_t>& offsets, const TVertex& v) noexcept
+		{
+			return { std::data(values) + offsets[index(v)], std::data(values) + offsets[index(v) + 1] };
+		}
+	};
+
+	/**
+	 * \brief The params of the hub label precomputation.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+		requires std::is_arithmetic_v<TWeight>
+	struct build_params
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief Alias for the result type.
+		 */
+		using labels_t = hub_labels::labels_t<TVertex, TWeight>;
+
+		/**
+		 * \brief The graph. Use ``make_csr_graph`` for creating it from a neighbor searcher and weight calculator.
+		 * \attention All weights must be greater or equal to zero.
+		 */
+		csr_graph<TVertex, TWeight> graph{};
+
+		/**
+		 * \brief The order, in which the vertices are used as hubs. Must either be empty or a permutation of all vertices.
+		 * \remark If empty, the vertices are ordered by their degree (descending).
+		 */
+		std::vector<TVertex> order{};
+
+		/**
+		 * \brief The amount of threads to be used. If set to 0, ``std::thread::hardware_concurrency`` is used.
+		 * \details The hubs are processed in batches of ``threadCount`` hubs, where the searches of one batch can not prune each
+		 * other. Thus more threads result in slightly larger labels.
+		 */
+		std::size_t threadCount{ 1 };
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TVertex, class TWeight>
+	using hub_label_entry_t = std::tuple<TVertex, TWeight>;
+
+	// dense dijkstra, which doesn't expand vertices, whose distance is already covered by the existing labels
+	template <class TVertex, class TWeight>
+	class hub_label_search
+	{
+	public:
+		using entry_t = hub_label_entry_t<TVertex, TWeight>;
+
+		static constexpr TWeight infinity{ std::numeric_limits<TWeight>::max() };
+
+		explicit hub_label_search(std::size_t vertexCount)
+			: m_Distances(vertexCount, infinity),
+			m_HubDistances(vertexCount, infinity)
+		{
+		}
+
+		// hubLabel is the label of the hub itself, which must be intersected with the opposite labels of each reached vertex
+		void run
+		(
+			const csr_graph<TVertex, TWeight>& graph,
+			const TVertex& hub,
+			const std::vector<entry_t>& hubLabel,
+			const std::vector<std::vector<entry_t>>& labels,
+			std::vector<std::tuple<TVertex, TWeight>>& result
+		)
+		{
+			for (const TVertex& v : m_Touched)
+			{
+				m_Distances[index(v)] = infinity;
+			}
+			m_Touched.clear();
+			result.clear();
+
+			for (const auto& [rank, distance] : hubLabel)
+			{
+				m_HubDistances[index(rank)] = distance;
+			}
+
+			m_Distances[index(hub)] = TWeight{};
+			m_Touched.emplace_back(hub);
+			m_Queue.emplace(TWeight{}, hub);
+			while (!std::empty(m_Queue))
+			{
+				const auto [distance, v] = m_Queue.top();
+				m_Queue.pop();
+				if (m_Distances[index(v)] < distance || is_covered(labels[index(v)], distance))
+					continue;
+
+				result.emplace_back(v, distance);
+				const auto neighbors = graph.neighbors(v);
+				const auto weights = graph.neighbor_weights(v);
+				for (std::size_t edge{ 0 }; edge < std::size(neighbors); ++edge)
+				{
+					assert(!(weights[edge] < TWeight{}) && "weights must be greater or equal to zero.");
+
+					const TWeight cur_distance{ distance + weights[edge] };
+					TWeight& cur_tentative = m_Distances[index(neighbors[edge])];
+					if (cur_distance < cur_tentative)
+					{
+						if (cur_tentative == infinity)
+						{
+							m_Touched.emplace_back(neighbors[edge]);
+						}
+						cur_tentative = cur_distance;
+						m_Queue.emplace(cur_distance, neighbors[edge]);
+					}
+				}
+			}
+
+			for (const auto& [rank, distance] : hubLabel)
+			{
+				m_HubDistances[index(rank)] = infinity;
+			}
+		}
+
+	private:
+		std::vector<TWeight> m_Distances;
+		std::vector<TWeight> m_HubDistances;
+		std::vector<TVertex> m_Touched{};
+		std::priority_queue<std::tuple<TWeight, TVertex>, std::vector<std::tuple<TWeight, TVertex>>, std::greater<>> m_Queue{};
+
+		[[nodiscard]]
+		static constexpr std::size_t index(const TVertex& v) noexcept
+		{
+			return static_cast<std::size_t>(v);
+		}
+
+		[[nodiscard]]
+		bool is_covered(const std::vector<entry_t>& label, const TWeight& distance) const noexcept
+		{
+			return std::ranges::any_of
+			(
+				label,
+				[&](const entry_t& entry)
+				{
+					const TWeight& hubDistance{ m_HubDistances[index(std::get<0>(entry))] };
+					return hubDistance != infinity && !(distance < hubDistance + std::get<1>(entry));
+				}
+			);
+		}
+	};
+
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	std::vector<TVertex> hub_label_degree_order(const csr_graph<TVertex, TWeight>& graph, const csr_graph<TVertex, TWeight>& transposed)
+	{
+		const std::size_t vertexCount{ graph.vertex_count() };
+		std::vector<TVertex> order(vertexCount);
+		std::vector<std::size_t> degrees(vertexCount);
+		for (std::size_t i{ 0 }; i < vertexCount; ++i)
+		{
+			const auto v{ static_cast<TVertex>(i) };
+			order[i] = v;
+			degrees[i] = std::size(graph.neighbors(v)) + std::size(transposed.neighbors(v));
+		}
+
+		std::ranges::stable_sort(order, std::ranges::greater{}, [&](const TVertex& v) { return degrees[static_cast<std::size_t>(v)]; });
+		return order;
+	}
+
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	typename hub_labels::labels_t<TVertex, TWeight>::storage_t flatten_hub_labels(const std::vector<std::vector<hub_label_entry_t<TVertex, TWeight>>>& labels)
+	{
+		typename hub_labels::labels_t<TVertex, TWeight>::storage_t storage{};
+		storage.offsets.reserve(std::size(labels) + 1);
+		for (const auto& label : labels)
+		{
+			for (const auto& [rank, distance] : label)
+			{
+				storage.hubs.emplace_back(rank);
+				storage.distances.emplace_back(distance);
+			}
+			storage.offsets.emplace_back(std::size(storage.hubs));
+		}
+		return storage;
+	}
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Precomputes the hub labels.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \param params The build_params object.
+	 * \return Returns the labels.
+	 * \details The hubs are processed in batches, where each thread runs the forward and backward search of one hub. The searches
+	 * of a batch only read the labels of the previous batches, which are extended afterwards. As the hubs are processed in rank
+	 * order, appending the entries keeps each label sorted.
+	 * \ingroup hub_labels
+	 */
+	template <class TVertex, class TWeight>
+	[[nodiscard]]
+	hub_labels::labels_t<TVertex, TWeight> build_hub_labels(const hub_labels::build_params<TVertex, TWeight>& params)
+	{
+		using entry_t = detail::hub_label_entry_t<TVertex, TWeight>;
+		using result_t = std::vector<std::tuple<TVertex, TWeight>>;
+
+		const std::size_t vertexCount{ params.graph.vertex_count() };
+		const csr_graph<TVertex, TWeight> transposed{ transpose(params.graph) };
+		std::vector<TVertex> order{ std::empty(params.order) ? detail::hub_label_degree_order(params.graph, transposed) : params.order };
+		assert(std::size(order) == vertexCount && "order must contain each vertex exactly once.");
+
+		std::vector<std::vector<entry_t>> outLabels(vertexCount);
+		std::vector<std::vector<entry_t>> inLabels(vertexCount);
+
+		const std::size_t threadCount{ std::min(detail::resolve_thread_count(params.threadCount), std::max<std::size_t>(vertexCount, 1)) };
+		std::vector<result_t> forwardResults(threadCount);
+		std::vector<result_t> backwardResults(threadCount);
+		detail::thread_barrier barrier{ threadCount };
+		detail::run_parallel
+		(
+			threadCount,
+			barrier,
+			[&](const std::size_t threadIndex)
+			{
+				detail::hub_label_search<TVertex, TWeight> search{ vertexCount };
+				for (std::size_t batchBegin{ 0 }; batchBegin < vertexCount; batchBegin += threadCount)
+				{
+					const std::size_t batchSize{ std::min(threadCount, vertexCount - batchBegin) };
+					if (threadIndex < batchSize)
+					{
+						const TVertex& hub{ order[batchBegin + threadIndex] };
+						const auto hubIndex{ static_cast<std::size_t>(hub) };
+						search.run(params.graph, hub, outLabels[hubIndex], inLabels, forwardResults[threadIndex]);
+						search.run(transposed, hub, inLabels[hubIndex], outLabels, backwardResults[threadIndex]);
+					}
+					barrier.arrive_and_wait();
+
+					if (threadIndex == 0)
+					{
+						for (std::size_t i{ 0 }; i < batchSize; ++i)
+						{
+							const auto rank{ static_cast<TVertex>(batchBegin + i) };
+							for (const auto& [v, distance] : forwardResults[i])
+							{
+								inLabels[static_cast<std::size_t>(v)].emplace_back(rank, distance);
+							}
+							for (const auto& [v, distance] : backwardResults[i])
+							{
+								outLabels[static_cast<std::size_t>(v)].emplace_back(rank, distance);
+							}
+						}
+					}
+					barrier.arrive_and_wait();
+				}
+			}
+		);
+
+		return
+		{
+			std::move(order),
+			detail::flatten_hub_labels<TVertex, TWeight>(outLabels),
+			detail::flatten_hub_labels<TVertex, TWeight>(inLabels)
+		};
+	}
+}
+
+#endif
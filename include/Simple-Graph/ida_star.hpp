@@ -0,0 +1,418 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_IDA_STAR_HPP
+#define SIMPLE_GRAPH_IDA_STAR_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+namespace sl::graph::ida_star
+{
+	/** \addtogroup ida_star
+	* @{
+	* \brief Provides the iterative deepening A* (IDA*).
+	* \details The algorithm runs consecutive depth-first searches, which are bounded by the estimated total cost ``f = g + h``. After
+	* each iteration the bound is raised to the least exceeding f value. Unlike astar, only the current path is kept in memory, thus
+	* the algorithm is applicable to huge implicit graphs, where vertices are generated on the fly.
+	* Vertices may be expanded multiple times; a small transposition table reduces those re-expansions, while keeping the memory
+	* bounded.
+	*/
+
+	/**
+	 * \brief The node type of the algorithm.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using node_t = astar::node_t<TVertex, TWeight>;
+
+	/**
+	 * \brief Transposition table, which never prunes anything.
+	 */
+	struct no_transposition_table_t
+	{
+		/**
+		 * \brief Always returns false.
+		 */
+		[[nodiscard]]
+		constexpr bool prune(std::size_t /*iteration*/, const auto& /*vertex*/, const auto& /*weightSum*/) const noexcept
+		{
+			return false;
+		}
+	};
+
+	/**
+	 * \brief Fixed size transposition table, which stores the least cost each vertex has been reached with during the current iteration.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 * \tparam THash The hash type.
+	 * \details The table is direct mapped, thus colliding vertices simply replace each other. The memory usage stays constant,
+	 * regardless of the size of the graph.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight, class THash = std::hash<TVertex>>
+	class transposition_table_t
+	{
+	public:
+		/**
+		 * \brief Constructor.
+		 * \param capacity The amount of entries. Must be greater than zero.
+		 * \param hash The hash object.
+		 */
+		explicit transposition_table_t(std::size_t capacity, THash hash = {})
+			: m_Entries(capacity),
+			m_Hash{ std::move(hash) }
+		{
+			assert(0 < capacity && "capacity must be greater than zero.");
+		}
+
+		/**
+		 * \brief Returns the amount of entries.
+		 */
+		[[nodiscard]]
+		std::size_t capacity() const noexcept
+		{
+			return std::size(m_Entries);
+		}
+
+		/**
+		 * \brief Determines whether the vertex has already been reached with equal or less cost during the current iteration.
+		 * Otherwise the entry is updated.
+		 * \param iteration The current iteration.
+		 * \param vertex The vertex.
+		 * \param weightSum The cost of the current path towards the vertex.
+		 * \return Returns true, if the vertex shall be skipped.
+		 */
+		[[nodiscard]]
+		bool prune(std::size_t iteration, const TVertex& vertex, const TWeight& weightSum)
+		{
+			entry_t& entry = m_Entries[std::invoke(m_Hash, vertex) % std::size(m_Entries)];
+			if (entry.iteration == iteration && entry.vertex == vertex && !(weightSum < entry.weightSum))
+				return true;
+
+			entry = { .iteration = iteration, .vertex = vertex, .weightSum = weightSum };
+			return false;
+		}
+
+	private:
+		struct entry_t
+		{
+			// iterations start at 1, thus default constructed entries are never matched
+			std::size_t iteration{ 0 };
+			TVertex vertex{};
+			TWeight weightSum{};
+		};
+
+		std::vector<entry_t> m_Entries;
+		THash m_Hash;
+	};
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \tparam THeuristic The heuristic type.
+	 * \tparam TCallback The callback type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TTranspositionTable The transposition table type.
+	 */
+	template <
+		vertex_descriptor TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator,
+		astar::compatible_heuristic_for<TVertex, TWeightCalculator> THeuristic,
+		node_callback<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TCallback = empty_invokable_t,
+		vertex_predicate_for<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TVertexPredicate = true_constant_t,
+		class TTranspositionTable = no_transposition_table_t>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::remove_cvref_t<TVertex>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = detail::astar_node<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the heuristic type.
+		 */
+		using heuristic_t = THeuristic;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the transposition table type.
+		 */
+		using transposition_table_t = TTranspositionTable;
+
+		/**
+		 * \brief The vertex to start the traversal.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The heuristic to be used. Must be an invokable type, which returns the estimated remaining cost between the current vertex and
+		 * the destination.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must neither be less than zero nor overestimate the cost to the destination.
+		 */
+		THeuristic heuristic{};
+
+		/**
+		 * \brief The callback object to be invoked for each expanded node.
+		 * \remark If not set, an empty_invokable_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * void operator()(const node_t& current)
+		 * \endcode
+		 *
+		 * Alternatively the invoke operator may return a boolean-convertible type, where true indicates that the algorithm shall
+		 * be aborted.
+		 * \note As each iteration starts from scratch, the callback may be invoked multiple times for the same vertex.
+		 */
+		TCallback callback{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each discovered vertex.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether a vertex shall be further investigated, where false means it will be skipped.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The transposition table to be used.
+		 * \remark If not set, a no_transposition_table_t object is used.
+		 * \details The signature of the prune function should match the following:
+		 * \code
+		 * bool prune(std::size_t iteration, const vertex_t& current, const weight_t& weightSum)
+		 * \endcode
+		 * where true indicates, that the current path towards the vertex shall not be investigated any further.
+		 * \see transposition_table_t
+		 */
+		TTranspositionTable transpositionTable{};
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	// returns the vertices of the current path in reversed order, if the callback requested the abort
+	template <class TNode, vertex_descriptor TVertex = node_vertex_t<TNode>, weight TWeight = node_weight_t<TNode>>
+	std::optional<std::vector<TVertex>> ida_star_traverse
+	(
+		node_factory_for<TNode> auto&& nodeFactory,
+		TNode begin,
+		neighbor_searcher_for<TVertex> auto&& neighborSearcher,
+		node_callback<TNode> auto&& callback,
+		vertex_predicate_for<TNode> auto&& vertexPredicate,
+		auto&& transpositionTable
+	)
+	{
+		struct frame_t
+		{
+			TNode node{};
+			std::vector<TVertex> neighbors{};
+			std::size_t index{ 0 };
+		};
+
+		std::vector<frame_t> path{};
+		const auto extract_path = [&]
+		{
+			std::vector<TVertex> result{};
+			result.reserve(std::size(path));
+			for (const frame_t& frame : path | std::views::reverse)
+			{
+				result.emplace_back(frame.node.vertex);
+			}
+			return result;
+		};
+
+		std::optional<TWeight> bound{ static_cast<TWeight>(begin) };
+		for (std::size_t iteration{ 1 }; bound; ++iteration)
+		{
+			std::optional<TWeight> nextBound{};
+			const auto try_expand = [&](TNode node)
+			{
+				if (*bound < static_cast<TWeight>(node))
+				{
+					if (!nextBound || static_cast<TWeight>(node) < *nextBound)
+					{
+						nextBound = static_cast<TWeight>(node);
+					}
+					return false;
+				}
+
+				if (detail::shall_interrupt(callback, std::as_const(node)))
+					return true;
+
+				auto&& neighbors = std::invoke(neighborSearcher, node.vertex);
+				path.emplace_back(frame_t{ .node = std::move(node), .neighbors = { std::ranges::begin(neighbors), std::ranges::end(neighbors) } });
+				return false;
+			};
+
+			path.clear();
+			if (try_expand(begin))
+			{
+				path.emplace_back(frame_t{ .node = begin });
+				return extract_path();
+			}
+
+			while (!std::empty(path))
+			{
+				frame_t& frame = path.back();
+				if (std::size(frame.neighbors) <= frame.index)
+				{
+					path.pop_back();
+					continue;
+				}
+
+				const TVertex cur_vertex{ frame.neighbors[frame.index++] };
+				if (std::ranges::find(path, cur_vertex, [](const frame_t& f) -> const TVertex& { return f.node.vertex; }) != std::end(path)
+					|| !std::invoke(vertexPredicate, std::as_const(frame.node), cur_vertex))
+					continue;
+
+				TNode current{ std::invoke(nodeFactory, frame.node, cur_vertex) };
+				if (transpositionTable.prune(iteration, current.vertex, current.weight_sum))
+					continue;
+
+				if (const TNode node{ current }; try_expand(std::move(current)))
+				{
+					path.emplace_back(frame_t{ .node = node });
+					return extract_path();
+				}
+			}
+
+			bound = nextBound;
+		}
+		return std::nullopt;
+	}
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Overload for ida_star::search_params.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \details The search stops as soon as the callback returns true or the whole graph has been exhausted.
+	 * \ingroup ida_star
+	 */
+	template <class... TArgs>
+	void traverse(ida_star::search_params<TArgs...> params)
+	{
+		using params_t = ida_star::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		std::ignore = detail::ida_star_traverse<node_t>
+		(
+			detail::make_astar_node_factory<vertex_t>(std::ref(params.weightCalculator), std::ref(params.heuristic)),
+			node_t{ .vertex = params.begin, .weight_estimated = std::invoke(params.heuristic, params.begin) },
+			std::ref(params.neighborSearcher),
+			std::ref(params.callback),
+			std::ref(params.vertexPredicate),
+			params.transpositionTable
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm and returns a vector, where each element is a vertex on the found path.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns the path as vector if exists. Otherwise ``std::nullopt`` is returned.
+	 * \details The callback serves as destination predicate, thus it must return a boolean convertible type.
+	 * \note The path will be ordered from destination to begin, thus reversed.
+	 * \ingroup ida_star
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	std::optional<std::vector<typename ida_star::search_params<TArgs...>::vertex_t>> find_path(ida_star::search_params<TArgs...> params)
+	{
+		using params_t = ida_star::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		static_assert
+		(
+			std::convertible_to<std::invoke_result_t<typename params_t::callback_t, node_t>, bool>,
+			"The return type of the provided callback must be boolean convertible."
+		);
+
+		return detail::ida_star_traverse<node_t>
+		(
+			detail::make_astar_node_factory<vertex_t>(std::ref(params.weightCalculator), std::ref(params.heuristic)),
+			node_t{ .vertex = params.begin, .weight_estimated = std::invoke(params.heuristic, params.begin) },
+			std::ref(params.neighborSearcher),
+			std::ref(params.callback),
+			std::ref(params.vertexPredicate),
+			params.transpositionTable
+		);
+	}
+}
+
+#endif
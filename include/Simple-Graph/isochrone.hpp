@@ -0,0 +1,408 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_ISOCHRONE_HPP
+#define SIMPLE_GRAPH_ISOCHRONE_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "dijkstra.hpp"
+#include "generic_traverse.hpp"
+#include "path_finder.hpp"
+#include "utility.hpp"
+
+#include <cassert>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace sl::graph::isochrone
+{
+	/** \addtogroup isochrone
+	* @{
+	* \brief Provides a cost bounded dijkstra, which visits all vertices reachable within a given budget.
+	* \details Unlike a dijkstra with an aborting callback, vertices exceeding the budget are rejected as soon as they are discovered,
+	* thus they never enter the open list.
+	*/
+
+	/**
+	 * \brief The node type of the algorithm.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using node_t = dijkstra::node_t<TVertex, TWeight>;
+
+	/**
+	 * \brief The state type of the algorithm.
+	 */
+	template <weight TWeight>
+	using state_t = dijkstra::state_t<TWeight>;
+
+	/**
+	 * \brief The default open list type of the algorithm.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using default_open_list_t = dijkstra::default_open_list_t<TVertex, TWeight>;
+
+	/**
+	 * \brief Element type of the reached vertices.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	struct reached_t
+	{
+		/**
+		 * \brief The reached vertex.
+		 */
+		TVertex vertex{};
+
+		/**
+		 * \brief The least cost of reaching the vertex.
+		 */
+		TWeight weight_sum{};
+
+		[[nodiscard]]
+		constexpr bool operator ==(const reached_t& other) const noexcept = default;
+	};
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \tparam TLowerBound The lower bound type.
+	 * \tparam TCallback The callback type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TStateMap The state map type.
+	 * \tparam TOpenList The open list type.
+	 */
+	template <
+		vertex_descriptor TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator,
+		astar::compatible_heuristic_for<TVertex, TWeightCalculator> TLowerBound = constant_t<0>,
+		node_callback<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TCallback = empty_invokable_t,
+		vertex_predicate_for<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TVertexPredicate = true_constant_t,
+		state_map_for<TVertex, state_t<detail::weight_type_of_t<TWeightCalculator, TVertex>>> TStateMap
+		= std::map<TVertex, state_t<detail::weight_type_of_t<TWeightCalculator, TVertex>>>,
+		open_list_for<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TOpenList
+		= default_open_list_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::remove_cvref_t<TVertex>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = weighted_node<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the lower bound type.
+		 */
+		using lower_bound_t = TLowerBound;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = std::remove_cvref_t<TStateMap>;
+
+		/**
+		 * \brief Alias for the open list type.
+		 */
+		using open_list_t = std::remove_cvref_t<TOpenList>;
+
+		/**
+		 * \brief The vertex to start the traversal.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The budget. Vertices, which can not be reached with at most this cost, are pruned.
+		 */
+		weight_t budget{};
+
+		/**
+		 * \brief Optional lower bound of the cost, which is required in addition to reaching a vertex.
+		 * \remark If not set, a constant_t<0> object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& current)
+		 * \endcode
+		 * A vertex is pruned, if the cost of reaching it plus its lower bound exceeds the budget. This may for example be the
+		 * cost of returning to the begin, if only round trips are of interest.
+		 * \attention The returned value must never be less than zero.
+		 */
+		TLowerBound lowerBound{};
+
+		/**
+		 * \brief The callback object to be invoked for each reached node.
+		 * \remark If not set, an empty_invokable_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * void operator()(const node_t& current)
+		 * \endcode
+		 *
+		 * Alternatively the invoke operator may return a boolean-convertible type, where true indicates that the algorithm shall
+		 * be aborted.
+		 */
+		TCallback callback{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each discovered vertex.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether a vertex shall be further investigated, where false means it will be skipped.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The state map prototype object.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \see state_map_for concept for the actual type requirements.
+		 */
+		TStateMap stateMap{};
+
+		/**
+		 * \brief The open list prototype object.
+		 * \note If not explicitly set, a ``std::priority_queue`` is used.
+		 * \see open_list_for concept for the actual type requirements.
+		 */
+		TOpenList openList{};
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	// the weight of the most recently checked edge is cached, thus the node factory doesn't have to calculate it again
+	template <class TParams>
+	struct isochrone_pruner
+	{
+		using vertex_t = typename TParams::vertex_t;
+		using weight_t = typename TParams::weight_t;
+		using node_t = typename TParams::node_t;
+
+		TParams* params{};
+		std::optional<std::tuple<vertex_t, vertex_t, weight_t>> cachedEdge{};
+
+		[[nodiscard]]
+		bool is_within_budget(const vertex_t& v, const weight_t& weightSum)
+		{
+			const weight_t bound{ std::invoke(params->lowerBound, v) };
+			assert(weight_t{} <= bound && "lower bound must be greater or equal zero.");
+			return !(params->budget < weightSum + bound);
+		}
+
+		[[nodiscard]]
+		bool accept(const node_t& predecessor, const vertex_t& cur_vertex)
+		{
+			if (!std::invoke(params->vertexPredicate, predecessor, cur_vertex))
+				return false;
+
+			const weight_t rel_weight{ std::invoke(params->weightCalculator, predecessor.vertex, cur_vertex) };
+			assert(weight_t{} <= rel_weight && "relative weight between nodes must be greater or equal zero.");
+			cachedEdge.emplace(predecessor.vertex, cur_vertex, rel_weight);
+			return is_within_budget(cur_vertex, predecessor.weight_sum + rel_weight);
+		}
+
+		[[nodiscard]]
+		node_t make_node(const node_t& predecessor, const vertex_t& cur_vertex)
+		{
+			assert(cachedEdge && std::get<0>(*cachedEdge) == predecessor.vertex && std::get<1>(*cachedEdge) == cur_vertex);
+
+			return
+			{
+				.predecessor = predecessor.vertex,
+				.vertex = cur_vertex,
+				.weight_sum = predecessor.weight_sum + std::get<2>(*cachedEdge)
+			};
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Overload for isochrone::search_params.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \ingroup isochrone
+	 */
+	template <class... TArgs>
+	void traverse(isochrone::search_params<TArgs...> params)
+	{
+		using params_t = isochrone::search_params<TArgs...>;
+		using node_t = typename params_t::node_t;
+
+		detail::isochrone_pruner<params_t> pruner{ .params = &params };
+		if (!pruner.is_within_budget(params.begin, {}))
+			return;
+
+		detail::dynamic_cost_traverse<node_t>
+		(
+			[&](const node_t& predecessor, const auto& cur_vertex) { return pruner.make_node(predecessor, cur_vertex); },
+			node_t{ .vertex = params.begin },
+			std::ref(params.neighborSearcher),
+			std::ref(params.callback),
+			[&](const node_t& predecessor, const auto& cur_vertex) { return pruner.accept(predecessor, cur_vertex); },
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	/**
+	 * \brief Collects all vertices, which are reachable within the budget.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns each reached vertex with its least cost, ordered by non-decreasing cost.
+	 * \details The callback is still invoked for each reached node and may abort the algorithm.
+	 * \ingroup isochrone
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	std::vector<isochrone::reached_t<typename isochrone::search_params<TArgs...>::vertex_t, typename isochrone::search_params<TArgs...>::weight_t>>
+	reachable_vertices(isochrone::search_params<TArgs...> params)
+	{
+		using params_t = isochrone::search_params<TArgs...>;
+		using reached_t = isochrone::reached_t<typename params_t::vertex_t, typename params_t::weight_t>;
+
+		std::vector<reached_t> result{};
+		auto callback = std::move(params.callback);
+		traverse
+		(
+			isochrone::search_params
+			{
+				.begin = std::move(params.begin),
+				.neighborSearcher = std::ref(params.neighborSearcher),
+				.weightCalculator = std::ref(params.weightCalculator),
+				.budget = std::move(params.budget),
+				.lowerBound = std::ref(params.lowerBound),
+				.callback = [&](const auto& node)
+				{
+					result.emplace_back(reached_t{ node.vertex, node.weight_sum });
+					return detail::shall_interrupt(callback, node);
+				},
+				.vertexPredicate = std::ref(params.vertexPredicate),
+				.stateMap = std::move(params.stateMap),
+				.openList = std::move(params.openList)
+			}
+		);
+		return result;
+	}
+
+	/**
+	 * \brief Executes the algorithm once and returns the paths to each of the given targets, which are reachable within the budget.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TVertex The used vertex type. Do not change!
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \param params The search_params object.
+	 * \param targets A range of target vertices. If the vertex type is totally ordered, each settled vertex is looked up via binary
+	 * search, otherwise linearly.
+	 * \param predecessorMap The provided predecessor map, where each predecessor will be stored in between.
+	 * \return Returns a vector with one element per target (in the same order), which is either the path to that target or
+	 * ``std::nullopt``, if the target can not be reached within the budget.
+	 * \details All paths share one search tree, which will be expanded until either each target has been settled or the
+	 * budget is exhausted.
+	 * \note The paths will be ordered from destination to begin, thus reversed.
+	 * \attention If the predecessorMap contains any predefined graph state, the behaviour is this function is undefined.
+	 * \ingroup isochrone
+	 */
+	template <
+		class... TArgs,
+		vertex_descriptor TVertex = typename isochrone::search_params<TArgs...>::vertex_t,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
+	[[nodiscard]]
+	std::vector<std::optional<std::vector<TVertex>>> find_paths
+	(
+		isochrone::search_params<TArgs...> params,
+		const std::ranges::input_range auto& targets,
+		TPredecessorMap predecessorMap = {}
+	)
+	{
+		using params_t = isochrone::search_params<TArgs...>;
+		using node_t = typename params_t::node_t;
+
+		return detail::extract_paths<node_t>
+		(
+			std::ref(params.callback),
+			targets,
+			std::move(predecessorMap),
+			[&](auto path_extractor)
+			{
+				traverse
+				(
+					isochrone::search_params
+					{
+						.begin = std::move(params.begin),
+						.neighborSearcher = std::ref(params.neighborSearcher),
+						.weightCalculator = std::ref(params.weightCalculator),
+						.budget = std::move(params.budget),
+						.lowerBound = std::ref(params.lowerBound),
+						.callback = std::ref(path_extractor),
+						.vertexPredicate = std::ref(params.vertexPredicate),
+						.stateMap = std::move(params.stateMap),
+						.openList = std::move(params.openList)
+					}
+				);
+			}
+		);
+	}
+}
+
+#endif
@@ -0,0 +1,437 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_LPA_STAR_HPP
+#define SIMPLE_GRAPH_LPA_STAR_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "utility.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <map>
+#include <optional>
+#include <queue>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::lpa_star
+{
+	/** \addtogroup lpa_star
+	* @{
+	* \brief Provides an incremental A* (LPA*), which repairs its previous search after edge weights changed.
+	* \details The planner keeps the distance estimate (g) and the one-step lookahead (rhs) of each vertex across multiple queries.
+	* After edges changed, only the vertices, whose distances are affected, are expanded again; thus a replanning is usually much cheaper
+	* than a new astar search.
+	*/
+
+	/**
+	 * \brief The node type of the algorithm. This is the node type of astar, thus heuristics and vertex predicates can be shared.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using node_t = astar::node_t<TVertex, TWeight>;
+
+	/**
+	 * \brief The state type of the algorithm. Stores g and rhs of a vertex, where ``std::nullopt`` denotes infinity.
+	 */
+	template <weight TWeight>
+	using state_t = std::tuple<std::optional<TWeight>, std::optional<TWeight>>;
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TPredecessorSearcher The predecessor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \tparam THeuristic The heuristic type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TStateMap The state map type.
+	 */
+	template <
+		vertex_descriptor TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		neighbor_searcher_for<TVertex> TPredecessorSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator,
+		astar::compatible_heuristic_for<TVertex, TWeightCalculator> THeuristic,
+		vertex_predicate_for<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TVertexPredicate = true_constant_t,
+		state_map_for<TVertex, state_t<detail::weight_type_of_t<TWeightCalculator, TVertex>>> TStateMap
+		= std::map<TVertex, state_t<detail::weight_type_of_t<TWeightCalculator, TVertex>>>>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::remove_cvref_t<TVertex>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = detail::astar_node<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the predecessor searcher type.
+		 */
+		using predecessor_searcher_t = TPredecessorSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the heuristic type.
+		 */
+		using heuristic_t = THeuristic;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = std::remove_cvref_t<TStateMap>;
+
+		/**
+		 * \brief The vertex to start the search.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The vertex to be reached.
+		 */
+		TVertex destination{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The predecessor searcher to be used. Must be an invokable type, which returns a range of vertices, which have an edge
+		 * towards the current vertex.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 * \note On undirected graphs, this is usually the neighbor searcher.
+		 */
+		TPredecessorSearcher predecessorSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The heuristic to be used. Must be an invokable type, which returns the estimated remaining cost between the current vertex and
+		 * the destination.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must neither be less than zero nor overestimate the cost to the destination.
+		 */
+		THeuristic heuristic{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each edge.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether the current vertex may be reached from the predecessor, where false means the edge will be
+		 * ignored.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The state map prototype object.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \see state_map_for concept for the actual type requirements.
+		 */
+		TStateMap stateMap{};
+	};
+
+	/**
+	 * \brief The incremental planner, which keeps its state across multiple queries.
+	 * \tparam TParams The search_params type.
+	 * \details The weight calculator, neighbor and predecessor searchers are invoked lazily; thus after the underlying graph changed,
+	 * users must report each changed edge via update_edges, before the path can be queried again.
+	 */
+	template <class TParams>
+	class planner_t
+	{
+	public:
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = typename TParams::vertex_t;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = typename TParams::weight_t;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = typename TParams::node_t;
+
+		/**
+		 * \brief Constructor.
+		 * \param params The search_params object.
+		 */
+		explicit planner_t(TParams params)
+			: m_Params{ std::move(params) }
+		{
+			std::get<1>(state(m_Params.begin)) = weight_t{};
+			push(m_Params.begin);
+		}
+
+		/**
+		 * \brief Returns the begin vertex.
+		 */
+		[[nodiscard]]
+		const vertex_t& begin() const noexcept
+		{
+			return m_Params.begin;
+		}
+
+		/**
+		 * \brief Returns the destination vertex.
+		 */
+		[[nodiscard]]
+		const vertex_t& destination() const noexcept
+		{
+			return m_Params.destination;
+		}
+
+		/**
+		 * \brief Returns the amount of vertices, which have been expanded since construction.
+		 */
+		[[nodiscard]]
+		std::size_t expansion_count() const noexcept
+		{
+			return m_ExpansionCount;
+		}
+
+		/**
+		 * \brief Informs the planner about edges, whose weights changed or which have been added or removed.
+		 * \tparam TEdgeRange The edge range type. Each element must be destructible into the from and to vertex.
+		 * \param edges The changed edges.
+		 * \details This doesn't search yet, but marks the target vertices as inconsistent.
+		 */
+		template <std::ranges::input_range TEdgeRange>
+		void update_edges(TEdgeRange&& edges)
+		{
+			for (const auto& [from, to] : edges)
+			{
+				update_vertex(to);
+			}
+		}
+
+		/**
+		 * \brief Informs the planner about vertices, whose in-edges changed.
+		 * \tparam TVertexRange The vertex range type.
+		 * \param vertices The changed vertices.
+		 * \details This is a convenience function for grids, where the cost of entering a cell changed.
+		 */
+		template <std::ranges::input_range TVertexRange>
+		void update_vertices(TVertexRange&& vertices)
+		{
+			for (const vertex_t& v : vertices)
+			{
+				update_vertex(v);
+			}
+		}
+
+		/**
+		 * \brief Repairs the search, until the distance of the destination is known.
+		 * \return Returns the distance of the destination, or ``std::nullopt`` if unreachable.
+		 */
+		std::optional<weight_t> compute_distance()
+		{
+			const vertex_t& destination = m_Params.destination;
+			while (!std::empty(m_OpenList))
+			{
+				const auto [key, v] = m_OpenList.top();
+				const std::optional destinationKey = calculate_key(destination);
+				const auto& [destinationG, destinationRhs] = state(destination);
+				if ((destinationKey && !(key < *destinationKey)) && destinationG == destinationRhs)
+					break;
+
+				m_OpenList.pop();
+				auto& [g, rhs] = state(v);
+				// stale entry; vertices are never removed from the open list
+				if (g == rhs || calculate_key(v) != key)
+					continue;
+
+				++m_ExpansionCount;
+				if (!g || (rhs && *rhs < *g))
+				{
+					g = rhs;
+				}
+				else
+				{
+					g = std::nullopt;
+					update_vertex(v);
+				}
+
+				for (const vertex_t& cur_vertex : std::invoke(m_Params.neighborSearcher, v))
+				{
+					update_vertex(cur_vertex);
+				}
+			}
+
+			return std::get<0>(state(destination));
+		}
+
+		/**
+		 * \brief Repairs the search and extracts the path towards the destination.
+		 * \return Returns the path in reversed order (destination first), or ``std::nullopt`` if destination is unreachable.
+		 */
+		[[nodiscard]]
+		std::optional<std::vector<vertex_t>> find_path()
+		{
+			if (!compute_distance())
+				return std::nullopt;
+
+			std::vector<vertex_t> path{ m_Params.destination };
+			while (path.back() != m_Params.begin)
+			{
+				const std::optional predecessor = best_predecessor(path.back());
+				assert(predecessor && "search is inconsistent.");
+				path.emplace_back(std::get<0>(*predecessor));
+			}
+			return { std::move(path) };
+		}
+
+	private:
+		using key_t = std::tuple<weight_t, weight_t>;
+		using open_list_entry_t = std::tuple<key_t, vertex_t>;
+
+		struct entry_greater
+		{
+			[[nodiscard]]
+			bool operator ()(const open_list_entry_t& lhs, const open_list_entry_t& rhs) const
+			{
+				return std::get<0>(rhs) < std::get<0>(lhs);
+			}
+		};
+
+		TParams m_Params;
+		std::priority_queue<open_list_entry_t, std::vector<open_list_entry_t>, entry_greater> m_OpenList{};
+		std::size_t m_ExpansionCount{ 0 };
+
+		[[nodiscard]]
+		auto& state(const vertex_t& v)
+		{
+			return m_Params.stateMap[v];
+		}
+
+		[[nodiscard]]
+		std::optional<key_t> calculate_key(const vertex_t& v)
+		{
+			const auto& [g, rhs] = state(v);
+			const std::optional<weight_t> minWeight{ !g ? rhs : !rhs ? g : std::min(*g, *rhs) };
+			if (!minWeight)
+				return std::nullopt;
+
+			const weight_t estimated{ std::invoke(m_Params.heuristic, v) };
+			assert(weight_t{} <= estimated && "estimated weight must be greater or equal zero.");
+			return key_t{ *minWeight + estimated, *minWeight };
+		}
+
+		void push(const vertex_t& v)
+		{
+			const std::optional key = calculate_key(v);
+			assert(key);
+			m_OpenList.emplace(*key, v);
+		}
+
+		// returns the predecessor, which minimizes g(predecessor) + c(predecessor, v)
+		[[nodiscard]]
+		std::optional<std::tuple<vertex_t, weight_t>> best_predecessor(const vertex_t& v)
+		{
+			std::optional<std::tuple<vertex_t, weight_t>> result{};
+			for (const vertex_t& predecessor : std::invoke(m_Params.predecessorSearcher, v))
+			{
+				const std::optional<weight_t> g = std::get<0>(state(predecessor));
+				if (!g)
+					continue;
+
+				const node_t predecessorNode
+				{
+					.vertex = predecessor,
+					.weight_sum = *g,
+					.weight_estimated = std::invoke(m_Params.heuristic, predecessor)
+				};
+				if (!std::invoke(m_Params.vertexPredicate, predecessorNode, v))
+					continue;
+
+				const weight_t rel_weight{ std::invoke(m_Params.weightCalculator, predecessor, v) };
+				assert(weight_t{} <= rel_weight && "relative weight between nodes must be greater or equal zero.");
+				if (const weight_t weight_sum{ *g + rel_weight }; !result || weight_sum < std::get<1>(*result))
+				{
+					result.emplace(predecessor, weight_sum);
+				}
+			}
+			return result;
+		}
+
+		void update_vertex(const vertex_t& v)
+		{
+			if (v != m_Params.begin)
+			{
+				std::optional predecessor = best_predecessor(v);
+				std::get<1>(state(v)) = predecessor ? std::optional{ std::get<1>(*predecessor) } : std::nullopt;
+			}
+
+			if (const auto& [g, rhs] = state(v); g != rhs)
+			{
+				push(v);
+			}
+		}
+	};
+
+	/**
+	 * \brief Deduction guide for the planner.
+	 */
+	template <class TParams>
+	planner_t(TParams) -> planner_t<TParams>;
+
+	/** @}*/
+}
+
+#endif
@@ -0,0 +1,425 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_MS_BFS_HPP
+#define SIMPLE_GRAPH_MS_BFS_HPP
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::ms_bfs
+{
+	/** \addtogroup ms_bfs
+	* @{
+	* \brief Provides the search_params and other related things modeling the bit-parallel multi source breadth first search.
+	* \details Runs up to ``mask_t::bit_count`` breadth first searches at once, where each search is represented by a single bit
+	* of the per-vertex masks. Each adjacency scan is therefore shared between all searches of a batch. Sources exceeding the
+	* capacity of a single mask are processed in subsequent batches.
+	* MS-BFS operates on graphs with dense vertex ids, thus each vertex must be an integral value in the range ``[0, vertexCount)``.
+	*/
+
+	/**
+	 * \brief Bit mask type, where each bit denotes one of the concurrent searches.
+	 * \tparam VWords The amount of 64 bit words.
+	 * \details All operations are plain loops over the words, which compilers reliably turn into vector instructions (e.g.
+	 * a single AVX2 instruction for a 256 bit mask), if the target architecture supports it.
+	 */
+	template <std::size_t VWords>
+		requires (0 < VWords)
+	struct mask_t
+	{
+		/**
+		 * \brief The amount of available bits.
+		 */
+		static constexpr std::size_t bit_count{ VWords * 64 };
+
+		/**
+		 * \brief The underlying words.
+		 */
+		std::array<std::uint64_t, VWords> words{};
+
+		/**
+		 * \brief Default equality operator.
+		 */
+		[[nodiscard]]
+		constexpr bool operator ==(const mask_t&) const noexcept = default;
+
+		/**
+		 * \brief Checks whether any bit is set.
+		 */
+		[[nodiscard]]
+		constexpr bool any() const noexcept
+		{
+			std::uint64_t result{};
+			for (const std::uint64_t word : words)
+				result |= word;
+			return result != 0;
+		}
+
+		/**
+		 * \brief Returns the amount of set bits.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t count() const noexcept
+		{
+			std::size_t result{};
+			for (const std::uint64_t word : words)
+				result += static_cast<std::size_t>(std::popcount(word));
+			return result;
+		}
+
+		/**
+		 * \brief Checks whether the bit at the given index is set.
+		 */
+		[[nodiscard]]
+		constexpr bool test(std::size_t index) const noexcept
+		{
+			assert(index < bit_count);
+			return (words[index / 64] >> (index % 64) & 1u) != 0;
+		}
+
+		/**
+		 * \brief Sets the bit at the given index.
+		 */
+		constexpr mask_t& set(std::size_t index) noexcept
+		{
+			assert(index < bit_count);
+			words[index / 64] |= std::uint64_t{ 1 } << (index % 64);
+			return *this;
+		}
+
+		/**
+		 * \brief Invokes the given function with the index of each set bit in ascending order.
+		 */
+		template <std::invocable<std::size_t> TFunc>
+		constexpr void for_each_bit(TFunc func) const
+		{
+			for (std::size_t i{ 0 }; i < VWords; ++i)
+			{
+				for (std::uint64_t word{ words[i] }; word != 0; word &= word - 1)
+				{
+					std::invoke(func, i * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+				}
+			}
+		}
+
+		constexpr mask_t& operator |=(const mask_t& other) noexcept
+		{
+			for (std::size_t i{ 0 }; i < VWords; ++i)
+				words[i] |= other.words[i];
+			return *this;
+		}
+
+		constexpr mask_t& operator &=(const mask_t& other) noexcept
+		{
+			for (std::size_t i{ 0 }; i < VWords; ++i)
+				words[i] &= other.words[i];
+			return *this;
+		}
+
+		[[nodiscard]]
+		friend constexpr mask_t operator |(mask_t lhs, const mask_t& rhs) noexcept
+		{
+			return lhs |= rhs;
+		}
+
+		[[nodiscard]]
+		friend constexpr mask_t operator &(mask_t lhs, const mask_t& rhs) noexcept
+		{
+			return lhs &= rhs;
+		}
+
+		[[nodiscard]]
+		friend constexpr mask_t operator ~(mask_t mask) noexcept
+		{
+			for (std::uint64_t& word : mask.words)
+				word = ~word;
+			return mask;
+		}
+	};
+
+	/**
+	 * \brief Mask type for 64 concurrent searches.
+	 */
+	using mask64_t = mask_t<1>;
+
+	/**
+	 * \brief Mask type for 256 concurrent searches.
+	 */
+	using mask256_t = mask_t<4>;
+
+	/**
+	 * \brief The node type of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TMask The mask type.
+	 */
+	template <std::integral TVertex, class TMask>
+	struct node_t
+	{
+		/**
+		 * \brief The reached vertex.
+		 */
+		TVertex vertex{};
+
+		/**
+		 * \brief The hop distance from each of the flagged sources.
+		 */
+		int depth{};
+
+		/**
+		 * \brief The sources, which reached the vertex in this depth. Bit i denotes the source at index ``batchOffset + i``.
+		 */
+		TMask sources{};
+
+		/**
+		 * \brief Index of the source, which is denoted by the first bit of the mask.
+		 */
+		std::size_t batchOffset{};
+	};
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TSources The source range type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TCallback The callback type.
+	 * \tparam TMask The mask type.
+	 */
+	template <
+		std::ranges::input_range TSources,
+		neighbor_searcher_for<std::ranges::range_value_t<TSources>> TNeighborSearcher,
+		class TCallback = empty_invokable_t,
+		class TMask = mask64_t>
+		requires std::integral<std::ranges::range_value_t<TSources>>
+				&& node_callback<TCallback, node_t<std::ranges::range_value_t<TSources>, TMask>>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::ranges::range_value_t<TSources>;
+
+		/**
+		 * \brief Alias for the mask type.
+		 */
+		using mask_t = TMask;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = ms_bfs::node_t<vertex_t, mask_t>;
+
+		/**
+		 * \brief Alias for the source range type.
+		 */
+		using sources_t = TSources;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief The source vertices. Each source is identified by its index in this range.
+		 */
+		TSources sources{};
+
+		/**
+		 * \brief The total amount of vertices. Each vertex must be in the range ``[0, vertexCount)``.
+		 */
+		std::size_t vertexCount{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The callback object to be invoked for each vertex, whenever it's reached by at least one source.
+		 * \remark If not set, an empty_invokable_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * void operator()(const node_t& current)
+		 * \endcode
+		 *
+		 * Alternatively the invoke operator may return a boolean-convertible type, where true indicates that the algorithm shall
+		 * be aborted.
+		 */
+		TCallback callback{};
+
+		/**
+		 * \brief The mask prototype object. Its type determines the amount of concurrent searches per batch.
+		 * \note If not explicitly set, a ``mask64_t`` is used.
+		 */
+		TMask mask{};
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TVertex, class TMask>
+	class ms_bfs_engine
+	{
+	public:
+		using vertex_t = TVertex;
+		using mask_t = TMask;
+		using node_t = ms_bfs::node_t<vertex_t, mask_t>;
+
+		explicit ms_bfs_engine(std::size_t vertexCount)
+			: m_Seen(vertexCount),
+			m_Visit(vertexCount),
+			m_VisitNext(vertexCount)
+		{
+		}
+
+		// returns true, if the callback requested an interruption
+		template <std::ranges::random_access_range TSources>
+		[[nodiscard]]
+		bool run_batch(const TSources& sources, std::size_t batchOffset, auto& neighborSearcher, auto& callback)
+		{
+			assert(std::ranges::size(sources) <= mask_t::bit_count);
+
+			reset();
+			for (std::size_t i{ 0 }; i < std::ranges::size(sources); ++i)
+			{
+				const vertex_t& source = sources[i];
+				const auto index{ static_cast<std::size_t>(source) };
+				assert(index < std::size(m_Seen) && "source is out of range.");
+
+				if (!m_Visit[index].any())
+				{
+					m_Frontier.emplace_back(source);
+				}
+				m_Visit[index].set(i);
+				m_Seen[index].set(i);
+			}
+
+			for (const vertex_t& v : m_Frontier)
+			{
+				if (shall_interrupt(callback, node_t{ .vertex = v, .depth = 0, .sources = m_Visit[static_cast<std::size_t>(v)], .batchOffset = batchOffset }))
+					return true;
+			}
+
+			for (int depth{ 1 }; !std::empty(m_Frontier); ++depth)
+			{
+				for (const vertex_t& v : m_Frontier)
+				{
+					const mask_t& visit = m_Visit[static_cast<std::size_t>(v)];
+					for (const vertex_t& cur_vertex : std::invoke(neighborSearcher, v))
+					{
+						const auto index{ static_cast<std::size_t>(cur_vertex) };
+						assert(index < std::size(m_Seen) && "vertex is out of range.");
+
+						if (const mask_t discovered{ visit & ~m_Seen[index] }; discovered.any())
+						{
+							mask_t& next = m_VisitNext[index];
+							if (!next.any())
+							{
+								m_NextFrontier.emplace_back(cur_vertex);
+							}
+							next |= discovered;
+						}
+					}
+				}
+
+				for (const vertex_t& v : m_Frontier)
+				{
+					m_Visit[static_cast<std::size_t>(v)] = {};
+				}
+
+				for (const vertex_t& v : m_NextFrontier)
+				{
+					const auto index{ static_cast<std::size_t>(v) };
+					m_Seen[index] |= m_VisitNext[index];
+					if (shall_interrupt(callback, node_t{ .vertex = v, .depth = depth, .sources = m_VisitNext[index], .batchOffset = batchOffset }))
+						return true;
+				}
+
+				std::swap(m_Visit, m_VisitNext);
+				std::swap(m_Frontier, m_NextFrontier);
+				m_NextFrontier.clear();
+			}
+			return false;
+		}
+
+	private:
+		std::vector<mask_t> m_Seen;
+		std::vector<mask_t> m_Visit;
+		std::vector<mask_t> m_VisitNext;
+		std::vector<vertex_t> m_Frontier{};
+		std::vector<vertex_t> m_NextFrontier{};
+		bool m_Dirty{};
+
+		void reset()
+		{
+			// the visit masks are always cleared after each level, thus only the seen masks need to be reset
+			if (std::exchange(m_Dirty, true))
+			{
+				std::ranges::fill(m_Seen, mask_t{});
+			}
+			m_Frontier.clear();
+			m_NextFrontier.clear();
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Overload for ms_bfs::search_params.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \ingroup ms_bfs
+	 */
+	template <class... TArgs>
+	void traverse(ms_bfs::search_params<TArgs...> params)
+	{
+		using params_t = ms_bfs::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using mask_t = typename params_t::mask_t;
+
+		std::vector<vertex_t> sources{};
+		std::ranges::copy(params.sources, std::back_inserter(sources));
+
+		detail::ms_bfs_engine<vertex_t, mask_t> engine{ params.vertexCount };
+		for (std::size_t batchOffset{ 0 }; batchOffset < std::size(sources); batchOffset += mask_t::bit_count)
+		{
+			const auto batch = std::views::counted
+			(
+				std::begin(sources) + static_cast<std::ptrdiff_t>(batchOffset),
+				static_cast<std::ptrdiff_t>(std::min(mask_t::bit_count, std::size(sources) - batchOffset))
+			);
+
+			if (engine.run_batch(batch, batchOffset, params.neighborSearcher, params.callback))
+				return;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,579 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_MULTI_SOURCE_HPP
+#define SIMPLE_GRAPH_MULTI_SOURCE_HPP
+
+#pragma once
+
+#include "breadth_first_search.hpp"
+#include "dijkstra.hpp"
+#include "generic_traverse.hpp"
+#include "path_finder.hpp"
+#include "utility.hpp"
+
+#include <map>
+#include <ranges>
+
+namespace sl::graph::detail
+{
+	template <class TNode>
+	struct origin_node
+		: public TNode
+	{
+		node_vertex_t<TNode> origin{};
+
+		[[nodiscard]]
+		constexpr bool operator ==(const origin_node& other) const noexcept = default;
+	};
+
+	template <class TNode, node_factory_for<TNode> TNodeFactory>
+	struct origin_node_factory_t
+	{
+		using node_t = origin_node<TNode>;
+
+		TNodeFactory nodeFactory{};
+
+		constexpr node_t operator ()(const node_t& predecessor, const node_vertex_t<TNode>& cur_vertex)
+		{
+			return { std::invoke(nodeFactory, static_cast<const TNode&>(predecessor), cur_vertex), predecessor.origin };
+		}
+	};
+
+	template <class TNode, class TNodeFactory>
+	[[nodiscard]]
+	constexpr origin_node_factory_t<TNode, TNodeFactory> make_origin_node_factory(TNodeFactory&& nodeFactory)
+	{
+		return { .nodeFactory = std::forward<TNodeFactory>(nodeFactory) };
+	}
+}
+
+template <class TNode>
+struct sl::graph::node_traits<sl::graph::detail::origin_node<TNode>>
+{
+	using node_t = detail::origin_node<TNode>;
+	using vertex_type = node_vertex_t<TNode>;
+	using weight_type = node_weight_t<TNode>;
+};
+
+namespace sl::graph::multi_source
+{
+	/** \addtogroup multi_source
+	* @{
+	* \brief Provides search_params for the dijkstra and breadth first search algorithms, which start from multiple vertices at once.
+	* \details Instead of a single begin vertex, a range of sources is seeded into the state map and open list, thus each vertex
+	* will be reached from its nearest source. This is what nearest-facility and voronoi-like queries require, without the need of
+	* an artificial super-source vertex.
+	*/
+
+	/**
+	 * \brief Node type, which additionally tracks the source vertex, from which the node originated.
+	 * \tparam TNode The underlying node type.
+	 */
+	template <class TNode>
+	using node_t = detail::origin_node<TNode>;
+
+	/**
+	 * \brief A source vertex with its initial weight.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	struct source_t
+	{
+		/**
+		 * \brief Alias for the given vertex type.
+		 */
+		using vertex_type = TVertex;
+
+		/**
+		 * \brief Alias for the given weight type.
+		 */
+		using weight_type = TWeight;
+
+		/**
+		 * \brief The source vertex.
+		 */
+		TVertex vertex{};
+
+		/**
+		 * \brief The initial weight of the source vertex.
+		 */
+		TWeight weight{};
+	};
+
+	/**
+	 * \brief Helper alias for the vertex type of a source range.
+	 * \tparam TSources The source range type.
+	 */
+	template <std::ranges::input_range TSources>
+	using source_vertex_t = typename std::ranges::range_value_t<TSources>::vertex_type;
+
+	/**
+	 * \brief Helper alias for the weight type of a source range.
+	 * \tparam TSources The source range type.
+	 */
+	template <std::ranges::input_range TSources>
+	using source_weight_t = typename std::ranges::range_value_t<TSources>::weight_type;
+
+	/**
+	 * \brief The search_params of the multi source dijkstra algorithm.
+	 * \tparam TSources The source range type. Its elements must be ``source_t`` objects.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \tparam TCallback The callback type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TStateMap The state map type.
+	 * \tparam TOpenList The open list type.
+	 */
+	template <
+		std::ranges::input_range TSources,
+		neighbor_searcher_for<source_vertex_t<TSources>> TNeighborSearcher,
+		weight_calculator_for<source_vertex_t<TSources>> TWeightCalculator,
+		node_callback<node_t<dijkstra::node_t<source_vertex_t<TSources>, source_weight_t<TSources>>>> TCallback = empty_invokable_t,
+		vertex_predicate_for<node_t<dijkstra::node_t<source_vertex_t<TSources>, source_weight_t<TSources>>>> TVertexPredicate
+		= true_constant_t,
+		state_map_for<source_vertex_t<TSources>, dijkstra::state_t<source_weight_t<TSources>>> TStateMap
+		= std::map<source_vertex_t<TSources>, dijkstra::state_t<source_weight_t<TSources>>>,
+		open_list_for<node_t<dijkstra::node_t<source_vertex_t<TSources>, source_weight_t<TSources>>>> TOpenList
+		= std::priority_queue<
+			node_t<dijkstra::node_t<source_vertex_t<TSources>, source_weight_t<TSources>>>,
+			std::vector<node_t<dijkstra::node_t<source_vertex_t<TSources>, source_weight_t<TSources>>>>,
+			std::greater<>>>
+		requires std::same_as<source_weight_t<TSources>, detail::weight_type_of_t<TWeightCalculator, source_vertex_t<TSources>>>
+	struct dijkstra_search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = source_vertex_t<TSources>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = source_weight_t<TSources>;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = multi_source::node_t<dijkstra::node_t<vertex_t, weight_t>>;
+
+		/**
+		 * \brief Alias for the source range type.
+		 */
+		using sources_t = TSources;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = std::remove_cvref_t<TStateMap>;
+
+		/**
+		 * \brief Alias for the open list type.
+		 */
+		using open_list_t = std::remove_cvref_t<TOpenList>;
+
+		/**
+		 * \brief The range of sources to start the traversal from. If a vertex is listed multiple times, the source with the least
+		 * weight is used.
+		 */
+		TSources sources{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The callback object to be invoked for each finalized node. The ``origin`` member of the node denotes the source
+		 * vertex, from which the node has been reached.
+		 * \remark If not set, an empty_invokable_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * void operator()(const node_t& current)
+		 * \endcode
+		 *
+		 * Alternatively the invoke operator may return a boolean-convertible type, where true indicates that the algorithm shall
+		 * be aborted.
+		 */
+		TCallback callback{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each discovered vertex.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether a vertex shall be further investigated, where false means it will be skipped.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The state map prototype object.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \see state_map_for concept for the actual type requirements.
+		 */
+		TStateMap stateMap{};
+
+		/**
+		 * \brief The open list prototype object.
+		 * \note If not explicitly set, a ``std::priority_queue`` is used.
+		 * \see open_list_for concept for the actual type requirements.
+		 * \attention As the used open list has a huge impact on the actual behaviour of the algorithm, the type of the provided
+		 * open list should model the behaviour of a priority-queue-like container. Otherwise this results in undefined behaviour.
+		 */
+		TOpenList openList{};
+	};
+
+	/**
+	 * \brief The search_params of the multi source breadth first search algorithm.
+	 * \tparam TSources The source range type. Its elements must be vertices.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TCallback The callback type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TStateMap The state map type.
+	 * \tparam TOpenList The open list type.
+	 */
+	template <
+		std::ranges::input_range TSources,
+		neighbor_searcher_for<std::ranges::range_value_t<TSources>> TNeighborSearcher,
+		node_callback<node_t<bfs::node_t<std::ranges::range_value_t<TSources>>>> TCallback = empty_invokable_t,
+		vertex_predicate_for<node_t<bfs::node_t<std::ranges::range_value_t<TSources>>>> TVertexPredicate = true_constant_t,
+		state_map_for<std::ranges::range_value_t<TSources>, bfs::state_t> TStateMap
+		= std::map<std::ranges::range_value_t<TSources>, bfs::state_t>,
+		open_list_for<node_t<bfs::node_t<std::ranges::range_value_t<TSources>>>> TOpenList
+		= std::queue<node_t<bfs::node_t<std::ranges::range_value_t<TSources>>>>>
+	struct bfs_search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::ranges::range_value_t<TSources>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = int;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = multi_source::node_t<bfs::node_t<vertex_t>>;
+
+		/**
+		 * \brief Alias for the source range type.
+		 */
+		using sources_t = TSources;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = std::remove_cvref_t<TStateMap>;
+
+		/**
+		 * \brief Alias for the open list type.
+		 */
+		using open_list_t = std::remove_cvref_t<TOpenList>;
+
+		/**
+		 * \brief The range of source vertices to start the traversal from. Each source has a depth of 0.
+		 */
+		TSources sources{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The callback object to be invoked for each finalized node. The ``origin`` member of the node denotes the source
+		 * vertex, from which the node has been reached.
+		 * \remark If not set, an empty_invokable_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * void operator()(const node_t& current)
+		 * \endcode
+		 *
+		 * Alternatively the invoke operator may return a boolean-convertible type, where true indicates that the algorithm shall
+		 * be aborted.
+		 */
+		TCallback callback{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each discovered vertex.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether a vertex shall be further investigated, where false means it will be skipped.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The state map prototype object.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \see state_map_for concept for the actual type requirements.
+		 */
+		TStateMap stateMap{};
+
+		/**
+		 * \brief The open list prototype object.
+		 * \note If not explicitly set, a ``std::queue`` is used.
+		 * \see open_list_for concept for the actual type requirements.
+		 * \attention As the used open list has a huge impact on the actual behaviour of the algorithm, the type of the provided
+		 * open list should model the behaviour of a queue-like container. Otherwise this results in undefined behaviour.
+		 */
+		TOpenList openList{};
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TNode>
+	[[nodiscard]]
+	constexpr auto make_dijkstra_source_nodes(auto& sources)
+	{
+		return sources
+				| std::views::transform
+				(
+					[](const auto& source) -> origin_node<TNode>
+					{
+						return { { .vertex = source.vertex, .weight_sum = source.weight }, source.vertex };
+					}
+				);
+	}
+
+	template <class TNode>
+	[[nodiscard]]
+	constexpr auto make_bfs_source_nodes(auto& sources)
+	{
+		return sources
+				| std::views::transform
+				(
+					[](const auto& source) -> origin_node<TNode>
+					{
+						return { { .vertex = source }, source };
+					}
+				);
+	}
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Overload for multi_source::dijkstra_search_params.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \ingroup multi_source
+	 */
+	template <class... TArgs>
+	void traverse(multi_source::dijkstra_search_params<TArgs...> params)
+	{
+		using params_t = multi_source::dijkstra_search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+		using base_node_t = dijkstra::node_t<vertex_t, typename params_t::weight_t>;
+
+		detail::dynamic_cost_traverse<node_t>
+		(
+			detail::make_origin_node_factory<base_node_t>(detail::make_weighted_node_factory<vertex_t>(std::ref(params.weightCalculator))),
+			detail::make_dijkstra_source_nodes<base_node_t>(params.sources),
+			std::ref(params.neighborSearcher),
+			std::ref(params.callback),
+			std::ref(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm and returns a vector, where each element is a vertex on the existing path.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TVertex The used vertex type. Do not change!
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \param params The search_params object.
+	 * \param predecessorMap The provided predecessor map, where each predecessor will be stored in between.
+	 * \return Returns the path as vector if exists. Otherwise ``std::nullopt`` is returned.
+	 * \details This function actually forwards the ``searcher_params`` to the appropriate traverse function, but
+	 * wraps the callback into a ``path_finder_t``. Unlike to the usual ``search_params`` constraints, the callback
+	 * must return a boolean convertible type.
+	 * \note The path will be ordered from destination to begin, thus reversed. The last element is the nearest source.
+	 * \attention If the predecessorMap contains any predefined graph state, the behaviour is this function is undefined.
+	 * \ingroup multi_source
+	 */
+	template <
+		class... TArgs,
+		vertex_descriptor TVertex = typename multi_source::dijkstra_search_params<TArgs...>::vertex_t,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
+	[[nodiscard]]
+	std::optional<std::vector<TVertex>> find_path
+	(
+		multi_source::dijkstra_search_params<TArgs...> params,
+		TPredecessorMap predecessorMap = {}
+	)
+	{
+		using params_t = multi_source::dijkstra_search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+		using base_node_t = dijkstra::node_t<vertex_t, typename params_t::weight_t>;
+
+		return detail::extract_path<node_t>
+		(
+			std::ref(params.callback),
+			std::move(predecessorMap),
+			[&](auto path_extractor)
+			{
+				detail::dynamic_cost_traverse<node_t>
+				(
+					detail::make_origin_node_factory<base_node_t>(detail::make_weighted_node_factory<vertex_t>(std::ref(params.weightCalculator))),
+					detail::make_dijkstra_source_nodes<base_node_t>(params.sources),
+					std::ref(params.neighborSearcher),
+					std::ref(path_extractor),
+					std::ref(params.vertexPredicate),
+					std::move(params.stateMap),
+					std::move(params.openList)
+				);
+			}
+		);
+	}
+
+	/**
+	 * \brief Overload for multi_source::bfs_search_params.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \ingroup multi_source
+	 */
+	template <class... TArgs>
+	void traverse(multi_source::bfs_search_params<TArgs...> params)
+	{
+		using params_t = multi_source::bfs_search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+		using base_node_t = bfs::node_t<vertex_t>;
+
+		detail::uniform_cost_traverse<node_t>
+		(
+			detail::make_origin_node_factory<base_node_t>(detail::make_weighted_node_factory<vertex_t>(constant_t<1>{})),
+			detail::make_bfs_source_nodes<base_node_t>(params.sources),
+			std::ref(params.neighborSearcher),
+			std::ref(params.callback),
+			std::ref(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	/**
+	 * \brief Executes the algorithm and returns a vector, where each element is a vertex on the existing path.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \tparam TVertex The used vertex type. Do not change!
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \param params The search_params object.
+	 * \param predecessorMap The provided predecessor map, where each predecessor will be stored in between.
+	 * \return Returns the path as vector if exists. Otherwise ``std::nullopt`` is returned.
+	 * \details This function actually forwards the ``searcher_params`` to the appropriate traverse function, but
+	 * wraps the callback into a ``path_finder_t``. Unlike to the usual ``search_params`` constraints, the callback
+	 * must return a boolean convertible type.
+	 * \note The path will be ordered from destination to begin, thus reversed. The last element is the nearest source.
+	 * \attention If the predecessorMap contains any predefined graph state, the behaviour is this function is undefined.
+	 * \ingroup multi_source
+	 */
+	template <
+		class... TArgs,
+		vertex_descriptor TVertex = typename multi_source::bfs_search_params<TArgs...>::vertex_t,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>>
+	[[nodiscard]]
+	std::optional<std::vector<TVertex>> find_path
+	(
+		multi_source::bfs_search_params<TArgs...> params,
+		TPredecessorMap predecessorMap = {}
+	)
+	{
+		using params_t = multi_source::bfs_search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+		using base_node_t = bfs::node_t<vertex_t>;
+
+		return detail::extract_path<node_t>
+		(
+			std::ref(params.callback),
+			std::move(predecessorMap),
+			[&](auto path_extractor)
+			{
+				detail::uniform_cost_traverse<node_t>
+				(
+					detail::make_origin_node_factory<base_node_t>(detail::make_weighted_node_factory<vertex_t>(constant_t<1>{})),
+					detail::make_bfs_source_nodes<base_node_t>(params.sources),
+					std::ref(params.neighborSearcher),
+					std::ref(path_extractor),
+					std::ref(params.vertexPredicate),
+					std::move(params.stateMap),
+					std::move(params.openList)
+				);
+			}
+		);
+	}
+}
+
+#endif
@@ -0,0 +1,264 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_PARALLEL_HELPER_HPP
+#define SIMPLE_GRAPH_PARALLEL_HELPER_HPP
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace sl::graph::detail
+{
+	[[nodiscard]]
+	inline std::size_t resolve_thread_count(std::size_t threadCount) noexcept
+	{
+		if (threadCount == 0)
+		{
+			threadCount = std::thread::hardware_concurrency();
+		}
+		return std::max<std::size_t>(threadCount, 1);
+	}
+
+	/*
+	 * Thrown by thread_barrier::arrive_and_wait, after the barrier got abandoned.
+	 */
+	struct barrier_abandoned
+	{
+	};
+
+	/*
+	 * Simple reusable barrier; std::barrier isn't available on all of the supported standard libraries yet.
+	 * The barrier may be abandoned, which releases all waiting threads by throwing barrier_abandoned.
+	 */
+	class thread_barrier
+	{
+	public:
+		explicit thread_barrier(std::size_t threadCount) noexcept
+			: m_ThreadCount{ threadCount }
+		{
+		}
+
+		void arrive_and_wait()
+		{
+			std::unique_lock lock{ m_Mutex };
+			if (m_Abandoned)
+				throw barrier_abandoned{};
+
+			const std::size_t generation{ m_Generation };
+			if (++m_Waiting == m_ThreadCount)
+			{
+				m_Waiting = 0;
+				++m_Generation;
+				m_Condition.notify_all();
+				return;
+			}
+			m_Condition.wait(lock, [&] { return m_Abandoned || generation != m_Generation; });
+			if (generation == m_Generation)
+				throw barrier_abandoned{};
+		}
+
+		void abandon()
+		{
+			{
+				std::scoped_lock lock{ m_Mutex };
+				m_Abandoned = true;
+			}
+			m_Condition.notify_all();
+		}
+
+	private:
+		std::mutex m_Mutex{};
+		std::condition_variable m_Condition{};
+		std::size_t m_ThreadCount;
+		std::size_t m_Waiting{};
+		std::size_t m_Generation{};
+		bool m_Abandoned{};
+	};
+
+	template <class TFunc, class TOnFailure>
+	void run_parallel_impl(std::size_t threadCount, TFunc& func, TOnFailure onFailure)
+	{
+		std::mutex exceptionMutex{};
+		std::exception_ptr exception{};
+		const auto invoke_guarded = [&](const std::size_t threadIndex) noexcept
+		{
+			try
+			{
+				std::invoke(func, threadIndex);
+			}
+			catch (...)
+			{
+				// the first exception is the origin; following ones are caused by the abandonment
+				{
+					std::scoped_lock lock{ exceptionMutex };
+					if (!exception)
+						exception = std::current_exception();
+				}
+				onFailure();
+			}
+		};
+
+		{
+			std::vector<std::jthread> threads{};
+			try
+			{
+				threads.reserve(threadCount - 1);
+				for (std::size_t i{ 1 }; i < threadCount; ++i)
+				{
+					threads.emplace_back(invoke_guarded, i);
+				}
+			}
+			catch (...)
+			{
+				// already started threads may wait for the missing ones, thus release them before joining
+				onFailure();
+				throw;
+			}
+			invoke_guarded(0);
+		}
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	/*
+	 * Invokes func(threadIndex) on threadCount threads, where the calling thread participates as thread 0.
+	 * Returns after all threads finished. If any invocation throws, the first exception is rethrown on the calling thread.
+	 */
+	template <std::invocable<std::size_t> TFunc>
+	void run_parallel(std::size_t threadCount, TFunc&& func)
+	{
+		run_parallel_impl(threadCount, func, [] {});
+	}
+
+	/*
+	 * Same as above, but abandons the barrier, which is shared by the invocations, if any of them throws. Otherwise the other
+	 * threads would wait for the failed one forever.
+	 */
+	template <std::invocable<std::size_t> TFunc>
+	void run_parallel(std::size_t threadCount, thread_barrier& barrier, TFunc&& func)
+	{
+		run_parallel_impl(threadCount, func, [&] { barrier.abandon(); });
+	}
+
+	/*
+	 * Invokes func(threadIndex, index) for each index in [0, count), distributed in contiguous chunks over threadCount threads.
+	 * The thread index may be used to address per-thread workspaces.
+	 */
+	template <std::invocable<std::size_t, std::size_t> TFunc>
+	void parallel_for(std::size_t threadCount, std::size_t count, TFunc&& func)
+	{
+		threadCount = std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(count, 1));
+		run_parallel
+		(
+			threadCount,
+			[&](const std::size_t threadIndex)
+			{
+				const std::size_t chunkBegin{ count * threadIndex / threadCount };
+				const std::size_t chunkEnd{ count * (threadIndex + 1) / threadCount };
+				for (std::size_t i{ chunkBegin }; i < chunkEnd; ++i)
+				{
+					std::invoke(func, threadIndex, i);
+				}
+			}
+		);
+	}
+
+	/*
+	 * Invokes func(index) for each index in [0, count), distributed in contiguous chunks over threadCount threads.
+	 */
+	template <std::invocable<std::size_t> TFunc>
+	void parallel_for(std::size_t threadCount, std::size_t count, TFunc&& func)
+	{
+		parallel_for(threadCount, count, [&](std::size_t, const std::size_t i) { std::invoke(func, i); });
+	}
+	/*
+	 * Invokes func(threadIndex, index) for each index in [0, count). Each thread starts with a contiguous chunk; threads running
+	 * out of work steal the upper half of the remaining range of another thread. Prefer this over parallel_for, if the costs of
+	 * the single invocations vary a lot.
+	 */
+	template <std::invocable<std::size_t, std::size_t> TFunc>
+	void work_stealing_for(std::size_t threadCount, std::size_t count, TFunc&& func)
+	{
+		assert(count <= std::numeric_limits<std::uint32_t>::max() && "count exceeds the supported range.");
+
+		// each range packs its begin into the lower and its end into the upper 32 bits, thus it can be updated atomically
+		constexpr auto pack = [](std::uint64_t begin, std::uint64_t end) { return end << 32 | begin; };
+		constexpr auto unpack_begin = [](std::uint64_t range) { return range & 0xFFFF'FFFF; };
+		constexpr auto unpack_end = [](std::uint64_t range) { return range >> 32; };
+
+		threadCount = std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(count, 1));
+		std::vector<std::atomic<std::uint64_t>> ranges(threadCount);
+		for (std::size_t i{ 0 }; i < threadCount; ++i)
+		{
+			ranges[i].store(pack(count * i / threadCount, count * (i + 1) / threadCount), std::memory_order_relaxed);
+		}
+
+		const auto take_front = [&](std::atomic<std::uint64_t>& range) -> std::optional<std::uint64_t>
+		{
+			std::uint64_t current{ range.load(std::memory_order_acquire) };
+			while (unpack_begin(current) < unpack_end(current))
+			{
+				if (range.compare_exchange_weak(current, pack(unpack_begin(current) + 1, unpack_end(current)), std::memory_order_acq_rel))
+					return unpack_begin(current);
+			}
+			return std::nullopt;
+		};
+
+		const auto steal_back = [&](std::atomic<std::uint64_t>& range) -> std::optional<std::uint64_t>
+		{
+			std::uint64_t current{ range.load(std::memory_order_acquire) };
+			while (unpack_begin(current) < unpack_end(current))
+			{
+				const std::uint64_t middle{ unpack_begin(current) + (unpack_end(current) - unpack_begin(current)) / 2 };
+				if (range.compare_exchange_weak(current, pack(unpack_begin(current), middle), std::memory_order_acq_rel))
+					return pack(middle, unpack_end(current));
+			}
+			return std::nullopt;
+		};
+
+		run_parallel
+		(
+			threadCount,
+			[&](const std::size_t threadIndex)
+			{
+				for (;;)
+				{
+					while (const std::optional index{ take_front(ranges[threadIndex]) })
+					{
+						std::invoke(func, threadIndex, static_cast<std::size_t>(*index));
+					}
+
+					std::optional<std::uint64_t> stolen{};
+					for (std::size_t offset{ 1 }; !stolen && offset < threadCount; ++offset)
+					{
+						stolen = steal_back(ranges[(threadIndex + offset) % threadCount]);
+					}
+
+					// all remaining work is already owned by other threads
+					if (!stolen)
+						return;
+
+					ranges[threadIndex].store(*stolen, std::memory_order_release);
+				}
+			}
+		);
+	}
+}
+
+#endif
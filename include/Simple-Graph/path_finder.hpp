@@ -8,10 +8,15 @@
 
 #include "utility.hpp"
 
+#include <algorithm>
 #include <concepts>
+#include <functional>
 #include <vector>
 #include <map>
 #include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
 
 namespace sl::graph
 {
@@ -26,6 +31,21 @@ namespace sl::graph
 		{ container[v] } -> std::assignable_from<std::optional<TVertex>>;
 		static_cast<bool>(container[v]);
 	};
+
+	/**
+	 * \brief Determines the order, in which the vertices of a path are written.
+	 */
+	enum class path_order
+	{
+		/**
+		 * \brief From destination to begin. This is the natural order of the predecessor chain.
+		 */
+		reversed,
+		/**
+		 * \brief From begin to destination.
+		 */
+		forward
+	};
 }
 
 namespace sl::graph::detail
@@ -43,7 +63,7 @@ namespace sl::graph::detail
 		bool success{ false };
 
 		[[nodiscard]]
-		bool operator ()(const TNode& node)
+		constexpr bool operator ()(const TNode& node)
 			requires requires
 			{
 				node.vertex;
@@ -73,33 +93,6 @@ namespace sl::graph::detail
 			return false;
 		}
 	};
-
-	template <class TNode>
-	[[nodiscard]]
-	std::optional<std::vector<node_vertex_t<TNode>>> extract_path
-	(
-		auto callback,
-		predecessor_map_for<node_vertex_t<TNode>> auto predecessorMap,
-		auto find_path_callback
-	)
-	{
-		static_assert
-		(
-			std::convertible_to<std::invoke_result_t<decltype(callback), TNode>, bool>,
-			"The return type of the provided callback must be boolean convertible."
-		);
-
-		std::vector<node_vertex_t<TNode>> path{};
-		auto pathFinder = make_path_finder<TNode>(std::ref(callback), std::back_inserter(path), std::move(predecessorMap));
-
-		std::invoke(find_path_callback, std::ref(pathFinder));
-
-		if (pathFinder.success)
-		{
-			return { std::move(path) };
-		}
-		return std::nullopt;
-	}
 }
 
 namespace sl::graph
@@ -138,4 +131,135 @@ namespace sl::graph
 	}
 }
 
+namespace sl::graph::detail
+{
+	template <class TNode>
+	[[nodiscard]]
+	constexpr std::optional<std::vector<node_vertex_t<TNode>>> extract_path
+	(
+		auto callback,
+		predecessor_map_for<node_vertex_t<TNode>> auto predecessorMap,
+		auto find_path_callback
+	)
+	{
+		static_assert
+		(
+			std::convertible_to<std::invoke_result_t<decltype(callback), TNode>, bool>,
+			"The return type of the provided callback must be boolean convertible."
+		);
+
+		std::vector<node_vertex_t<TNode>> path{};
+		auto pathFinder = make_path_finder<TNode>(std::ref(callback), std::back_inserter(path), std::move(predecessorMap));
+
+		std::invoke(find_path_callback, std::ref(pathFinder));
+
+		if (pathFinder.success)
+		{
+			return { std::move(path) };
+		}
+		return std::nullopt;
+	}
+
+	template <class TNode>
+	[[nodiscard]]
+	std::vector<std::optional<std::vector<node_vertex_t<TNode>>>> extract_paths
+	(
+		auto callback,
+		const std::ranges::input_range auto& targets,
+		predecessor_map_for<node_vertex_t<TNode>> auto predecessorMap,
+		auto traverse_callback
+	)
+	{
+		using vertex_t = node_vertex_t<TNode>;
+
+		// pairs of target and its index; if possible, they get sorted, thus the settled vertices can be looked up via binary search
+		std::vector<std::pair<vertex_t, std::size_t>> pendingTargets{};
+		for (const vertex_t& target : targets)
+		{
+			pendingTargets.emplace_back(target, std::size(pendingTargets));
+		}
+
+		constexpr auto projection = [](const auto& pair) -> const vertex_t& { return pair.first; };
+		const auto matching_targets = [&](const vertex_t& v)
+		{
+			if constexpr (std::totally_ordered<vertex_t>)
+				return std::ranges::equal_range(pendingTargets, v, std::ranges::less{}, projection);
+			else
+				return pendingTargets | std::views::filter([&](const auto& pair) { return projection(pair) == v; });
+		};
+
+		if constexpr (std::totally_ordered<vertex_t>)
+			std::ranges::sort(pendingTargets, std::ranges::less{}, projection);
+
+		std::vector<std::optional<std::vector<vertex_t>>> paths(std::size(pendingTargets));
+		if (std::empty(pendingTargets))
+			return paths;
+
+		std::vector<bool> reached(std::size(pendingTargets), false);
+		std::size_t remaining{ std::size(pendingTargets) };
+		std::invoke
+		(
+			traverse_callback,
+			[&](const TNode& node)
+			{
+				predecessorMap[node.vertex] = node.predecessor;
+
+				for (const auto& [target, index] : matching_targets(node.vertex))
+				{
+					reached[index] = true;
+					--remaining;
+				}
+
+				return shall_interrupt(callback, node) || remaining == 0;
+			}
+		);
+
+		for (const auto& [target, index] : pendingTargets)
+		{
+			if (!reached[index])
+				continue;
+
+			auto& path = paths[index].emplace();
+			path.emplace_back(target);
+			for (auto predecessor = predecessorMap[target]; predecessor; predecessor = predecessorMap[*predecessor])
+			{
+				path.emplace_back(*predecessor);
+			}
+		}
+		return paths;
+	}
+
+	// writes the path, which ends at destination, into the buffer and returns its length; if the buffer is too small, nothing
+	// will be written at all
+	template <class TVertex>
+	[[nodiscard]]
+	std::size_t write_path(auto& predecessorMap, const TVertex& destination, std::span<TVertex> buffer, path_order order)
+	{
+		std::size_t length{ 1 };
+		for (auto predecessor = predecessorMap[destination]; predecessor; predecessor = predecessorMap[*predecessor])
+		{
+			++length;
+		}
+
+		if (std::size(buffer) < length)
+			return length;
+
+		// for the forward order the buffer gets filled from its back, as the predecessor chain can only be walked backwards
+		auto write = [&, i = order == path_order::forward ? length : std::size_t{ 0 }](const TVertex& v) mutable
+		{
+			if (order == path_order::forward)
+				buffer[--i] = v;
+			else
+				buffer[i++] = v;
+		};
+
+		write(destination);
+		for (auto predecessor = predecessorMap[destination]; predecessor; predecessor = predecessorMap[*predecessor])
+		{
+			write(*predecessor);
+		}
+		return length;
+	}
+}
+
 #endif
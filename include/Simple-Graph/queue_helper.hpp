@@ -108,6 +108,64 @@ struct sl::graph::emplace_t<std::queue<TArgs...>>
 	}
 };
 
+/**
+ * \brief Specialization for std::priority_queue.
+ * \tparam TArgs Template arguments for std::priority_queue.
+ * \details Clears the underlying container, thus its allocated memory is kept if possible.
+ */
+template <class... TArgs>
+struct sl::graph::clear_t<std::priority_queue<TArgs...>>
+{
+	using container_t = std::priority_queue<TArgs...>;
+
+	/**
+	 * \brief The invocation operator. Removes all elements.
+	 * \param container The container object.
+	 */
+	constexpr void operator ()(container_t& container) const
+	{
+		// the underlying container is a protected member of all standard container adapters
+		struct accessor : container_t
+		{
+			static constexpr auto& underlying(container_t& adapter)
+			{
+				return adapter.*&accessor::c;
+			}
+		};
+
+		accessor::underlying(container).clear();
+	}
+};
+
+/**
+ * \brief Specialization for std::queue.
+ * \tparam TArgs Template arguments for std::queue.
+ * \details Clears the underlying container, thus its allocated memory is kept if possible.
+ */
+template <class... TArgs>
+struct sl::graph::clear_t<std::queue<TArgs...>>
+{
+	using container_t = std::queue<TArgs...>;
+
+	/**
+	 * \brief The invocation operator. Removes all elements.
+	 * \param container The container object.
+	 */
+	constexpr void operator ()(container_t& container) const
+	{
+		// the underlying container is a protected member of all standard container adapters
+		struct accessor : container_t
+		{
+			static constexpr auto& underlying(container_t& adapter)
+			{
+				return adapter.*&accessor::c;
+			}
+		};
+
+		accessor::underlying(container).clear();
+	}
+};
+
 /** @}*/
 
 #endif
@@ -0,0 +1,288 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_RESUMABLE_SEARCH_HPP
+#define SIMPLE_GRAPH_RESUMABLE_SEARCH_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "dijkstra.hpp"
+#include "generic_traverse.hpp"
+#include "path_finder.hpp"
+#include "utility.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace sl::graph::detail
+{
+	template <class TNode, class TCallback, class TPredecessorMap>
+	struct predecessor_recorder_t
+	{
+		TCallback callback{};
+		TPredecessorMap predecessors{};
+
+		[[nodiscard]]
+		constexpr bool operator ()(const TNode& node)
+		{
+			predecessors[node.vertex] = node.predecessor;
+			return shall_interrupt(callback, node);
+		}
+	};
+}
+
+namespace sl::graph::resumable
+{
+	/** \addtogroup resumable
+	* @{
+	* \brief Provides searches, which can be advanced in slices of a limited number of expansions.
+	*/
+
+	/**
+	 * \brief The status of a resumable search.
+	 */
+	enum class search_status : std::uint8_t
+	{
+		/**
+		 * \brief The search has neither found its destination nor run out of nodes yet.
+		 */
+		running,
+		/**
+		 * \brief The callback returned true for the node, which is accessible via ``result``.
+		 */
+		found,
+		/**
+		 * \brief All reachable nodes have been visited without the callback returning true.
+		 */
+		exhausted
+	};
+
+	/**
+	 * \brief A search, whose whole state is stored in the object itself, thus it can be advanced step by step.
+	 * \tparam TExpander The expander type, which holds the open list and the state map.
+	 * \tparam TCallback The callback type.
+	 * \details Each step visits at most the given number of nodes and reports whether the search shall be continued. This makes
+	 * it possible to spread a single search over several frames or ticks, without any threads or restarts involved.
+	 * \note Use ``make_resumable_search`` to create instances of this type.
+	 */
+	template <class TExpander, class TCallback>
+	class search
+	{
+	public:
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = typename TExpander::node_t;
+
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = node_vertex_t<node_t>;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief Constructor, which discovers the begin node.
+		 * \param expander The expander.
+		 * \param callback The callback, which will be invoked for each visited node.
+		 * \param begin The begin node.
+		 */
+		constexpr search(TExpander expander, TCallback callback, node_t begin)
+			: m_Expander{ std::move(expander) },
+			m_Callback{ std::move(callback) }
+		{
+			m_Expander.discover(std::move(begin));
+		}
+
+		/**
+		 * \brief Continues the search.
+		 * \param maxExpansions The maximum number of nodes, which will be visited during this step.
+		 * \return Returns the status after this step. Once the search is finished, each further step immediately returns the same
+		 * status again.
+		 */
+		constexpr search_status step(std::size_t maxExpansions)
+		{
+			for (; m_Status == search_status::running && 0 < maxExpansions; --maxExpansions)
+			{
+				std::optional<node_t> node{ m_Expander.next() };
+				if (!node)
+				{
+					m_Status = search_status::exhausted;
+				}
+				else if (detail::shall_interrupt(m_Callback, std::as_const(*node)))
+				{
+					m_Status = search_status::found;
+					m_Result = std::move(node);
+				}
+				else
+				{
+					m_Expander.expand(*node);
+				}
+			}
+			return m_Status;
+		}
+
+		/**
+		 * \brief Returns the status of the most recent step.
+		 */
+		[[nodiscard]]
+		constexpr search_status status() const noexcept
+		{
+			return m_Status;
+		}
+
+		/**
+		 * \brief Returns the node, for which the callback returned true.
+		 * \attention Calling this before the search has found its destination is undefined behaviour.
+		 */
+		[[nodiscard]]
+		constexpr const node_t& result() const
+		{
+			assert(m_Status == search_status::found && "The search has not found its destination yet.");
+
+			return *m_Result;
+		}
+
+		/**
+		 * \brief Returns the path from begin to the found node.
+		 * \return Returns the path as vector, if the search found its destination. Otherwise ``std::nullopt`` is returned.
+		 * \note The path will be ordered from destination to begin, thus reversed.
+		 * \remark Only available for searches, which have been created with a predecessor map.
+		 */
+		[[nodiscard]]
+		std::optional<std::vector<vertex_t>> path()
+			requires requires(TCallback& callback) { callback.predecessors; }
+		{
+			if (m_Status != search_status::found)
+				return std::nullopt;
+
+			std::vector<vertex_t> path{ m_Result->vertex };
+			for (auto predecessor = m_Callback.predecessors[m_Result->vertex]; predecessor; predecessor = m_Callback.predecessors[*predecessor])
+			{
+				path.emplace_back(*predecessor);
+			}
+			return path;
+		}
+
+	private:
+		TExpander m_Expander;
+		TCallback m_Callback;
+		search_status m_Status{ search_status::running };
+		std::optional<node_t> m_Result{};
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	// the created expanders take ownership of the search_params members, except of the begin vertex and the callback
+	template <class... TArgs>
+	[[nodiscard]]
+	auto make_dynamic_cost_expander(dijkstra::search_params<TArgs...>& params)
+	{
+		using params_t = dijkstra::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return make_expander<dynamic_cost_expander, node_t>
+		(
+			make_weighted_node_factory<vertex_t>(std::move(params.weightCalculator)),
+			std::move(params.neighborSearcher),
+			std::move(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	template <class... TArgs>
+	[[nodiscard]]
+	auto make_dynamic_cost_expander(astar::search_params<TArgs...>& params)
+	{
+		using params_t = astar::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return make_expander<dynamic_cost_expander, node_t>
+		(
+			make_astar_node_factory<vertex_t>(std::move(params.weightCalculator), std::move(params.heuristic)),
+			std::move(params.neighborSearcher),
+			std::move(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	template <class TParams>
+	concept resumable_search_params = requires(TParams& params) { make_dynamic_cost_expander(params); };
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Creates a resumable search.
+	 * \tparam TParams The search_params type. Either dijkstra::search_params or astar::search_params.
+	 * \param params The search_params object. The created search takes ownership of all of its members.
+	 * \return Returns a resumable::search object, which has not performed any step yet.
+	 * \details The callback may return true to mark the destination, which finishes the search with status ``found``.
+	 * \ingroup resumable
+	 */
+	template <detail::resumable_search_params TParams>
+	[[nodiscard]]
+	auto make_resumable_search(TParams params)
+	{
+		auto expander = detail::make_dynamic_cost_expander(params);
+		return resumable::search<decltype(expander), typename TParams::callback_t>
+		{
+			std::move(expander),
+			std::move(params.callback),
+			{ .vertex = std::move(params.begin) }
+		};
+	}
+
+	/**
+	 * \brief Creates a resumable search, which additionally records the predecessor of each visited vertex.
+	 * \tparam TParams The search_params type. Either dijkstra::search_params or astar::search_params.
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \param params The search_params object. The created search takes ownership of all of its members.
+	 * \param predecessorMap The predecessor map, where each predecessor will be stored in between.
+	 * \return Returns a resumable::search object, whose ``path`` member function yields the path to the found node.
+	 * \details As with ``find_path``, the callback must return a boolean convertible type, where true marks the destination.
+	 * \attention If the predecessorMap contains any predefined graph state, the behaviour is this function is undefined.
+	 * \ingroup resumable
+	 */
+	template <detail::resumable_search_params TParams, predecessor_map_for<typename TParams::vertex_t> TPredecessorMap>
+	[[nodiscard]]
+	auto make_resumable_search(TParams params, TPredecessorMap predecessorMap)
+	{
+		using node_t = typename TParams::node_t;
+		using callback_t = typename TParams::callback_t;
+		using recorder_t = detail::predecessor_recorder_t<node_t, callback_t, TPredecessorMap>;
+
+		static_assert
+		(
+			std::convertible_to<std::invoke_result_t<callback_t&, const node_t&>, bool>,
+			"The return type of the provided callback must be boolean convertible."
+		);
+
+		auto expander = detail::make_dynamic_cost_expander(params);
+		return resumable::search<decltype(expander), recorder_t>
+		{
+			std::move(expander),
+			recorder_t{ .callback = std::move(params.callback), .predecessors = std::move(predecessorMap) },
+			{ .vertex = std::move(params.begin) }
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,368 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_SHORTEST_PATH_TREE_HPP
+#define SIMPLE_GRAPH_SHORTEST_PATH_TREE_HPP
+
+#pragma once
+
+#include "csr_graph.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace sl::graph::sssp
+{
+	/** \addtogroup sssp
+	* @{
+	* \brief Provides the search_params and other related things for computing complete shortest-path-trees.
+	* \details The algorithm is a dijkstra search, which operates on graphs with dense vertex ids, thus each vertex must be an
+	* integral value in the range ``[0, vertexCount)``. In contrast to a ``traverse`` of ``dijkstra::search_params``, there is no
+	* callback involved; the search writes the distance and parent of each vertex directly into flat arrays, which are indexed by
+	* the vertex ids. These arrays contain plain values only, thus they can be handed as they are to vectorized code or be written
+	* to disk.
+	*/
+
+	/**
+	 * \brief The shortest-path-tree of a single begin vertex.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <std::integral TVertex, weight TWeight>
+		requires std::is_arithmetic_v<TWeight>
+	struct tree_t
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the weight type.
+		 */
+		using weight_t = TWeight;
+
+		/**
+		 * \brief The distance, which is assigned to unreachable vertices.
+		 */
+		static constexpr TWeight unreachable{ std::numeric_limits<TWeight>::max() };
+
+		/**
+		 * \brief The parent, which is assigned to unreachable vertices.
+		 */
+		static constexpr TVertex no_parent{ std::numeric_limits<TVertex>::max() };
+
+		/**
+		 * \brief The distance of each vertex, indexed by its id. Unreachable vertices are set to ``unreachable``.
+		 */
+		std::vector<TWeight> distances{};
+
+		/**
+		 * \brief The parent of each vertex on its shortest path, indexed by its id. The begin vertex is its own parent and all
+		 * unreachable vertices are set to ``no_parent``.
+		 */
+		std::vector<TVertex> parents{};
+
+		/**
+		 * \brief All reachable vertices in the order, in which they have been settled. Thus, the distances are ascending and each
+		 * parent is listed before its children.
+		 */
+		std::vector<TVertex> settleOrder{};
+
+		/**
+		 * \brief Determines whether the given vertex is reachable from the begin vertex.
+		 */
+		[[nodiscard]]
+		bool reachable(const TVertex& v) const noexcept
+		{
+			return parents[static_cast<std::size_t>(v)] != no_parent;
+		}
+	};
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 */
+	template <
+		std::integral TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator>
+		requires std::is_arithmetic_v<detail::weight_type_of_t<TWeightCalculator, TVertex>>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::remove_cvref_t<TVertex>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the tree type.
+		 */
+		using tree_t = sssp::tree_t<vertex_t, weight_t>;
+
+		/**
+		 * \brief The root of the tree.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The total amount of vertices. Each vertex must be in the range ``[0, vertexCount)``.
+		 */
+		std::size_t vertexCount{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 * \note If ``csr_neighbor_searcher`` and ``csr_weight_calculator`` of the same graph are used, the weights are read
+		 * directly from the edge array, instead of being looked up for each edge. If compiled with AVX2 support, the edges of
+		 * such graphs are then relaxed in blocks of eight, as long as the vertices are 32 bit integers and the weights are either
+		 * ``std::int32_t`` or ``float``.
+		 */
+		TWeightCalculator weightCalculator{};
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TTree>
+	void relax_edge
+	(
+		TTree& tree,
+		const typename TTree::vertex_t& predecessor,
+		const typename TTree::weight_t& distance,
+		const typename TTree::vertex_t& cur_vertex,
+		const typename TTree::weight_t& rel_weight,
+		auto& onImproved
+	)
+	{
+		using weight_t = typename TTree::weight_t;
+
+		assert(static_cast<std::size_t>(cur_vertex) < std::size(tree.distances) && "vertex is out of range.");
+		assert(weight_t{} <= rel_weight && "relative weight between nodes must be greater or equal zero.");
+
+		const auto index{ static_cast<std::size_t>(cur_vertex) };
+		if (const weight_t weight_sum{ distance + rel_weight }; weight_sum < tree.distances[index])
+		{
+			tree.distances[index] = weight_sum;
+			tree.parents[index] = predecessor;
+			onImproved(cur_vertex, weight_sum);
+		}
+	}
+
+	template <class TTree>
+	void relax_out_edges
+	(
+		auto& neighborSearcher,
+		auto& weightCalculator,
+		TTree& tree,
+		const typename TTree::vertex_t& predecessor,
+		auto onImproved
+	)
+	{
+		using vertex_t = typename TTree::vertex_t;
+		using weight_t = typename TTree::weight_t;
+
+		const weight_t distance{ tree.distances[static_cast<std::size_t>(predecessor)] };
+		for (const vertex_t& cur_vertex : std::invoke(neighborSearcher, predecessor))
+		{
+			relax_edge(tree, predecessor, distance, cur_vertex, std::invoke(weightCalculator, predecessor, cur_vertex), onImproved);
+		}
+	}
+
+	template <class TTree, class TGraph>
+	void relax_out_edges
+	(
+		csr_neighbor_searcher<TGraph>& neighborSearcher,
+		csr_weight_calculator<TGraph>& weightCalculator,
+		TTree& tree,
+		const typename TTree::vertex_t& predecessor,
+		auto onImproved
+	)
+	{
+		using vertex_t = typename TTree::vertex_t;
+		using weight_t = typename TTree::weight_t;
+
+		assert(neighborSearcher.graph == weightCalculator.graph && "neighbor searcher and weight calculator refer to different graphs.");
+
+		const weight_t distance{ tree.distances[static_cast<std::size_t>(predecessor)] };
+		const std::span<const vertex_t> targets{ neighborSearcher.graph->neighbors(predecessor) };
+		const std::span<const weight_t> weights{ neighborSearcher.graph->neighbor_weights(predecessor) };
+		std::size_t i{ 0 };
+
+#ifdef __AVX2__
+		// gathers the current distances of eight targets at once and compares them with the candidates, thus only improving edges
+		// reach the scalar relaxation; as that one compares again, duplicate targets within a single block are handled correctly
+		if constexpr (sizeof(vertex_t) == sizeof(std::int32_t) && (std::same_as<weight_t, std::int32_t> || std::same_as<weight_t, float>))
+		{
+			assert(std::size(tree.distances) <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()));
+
+			for (; i + 8 <= std::size(targets); i += 8)
+			{
+				const __m256i indices{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(std::data(targets) + i)) };
+				unsigned mask{};
+				if constexpr (std::same_as<weight_t, float>)
+				{
+					const __m256 candidates{ _mm256_add_ps(_mm256_set1_ps(distance), _mm256_loadu_ps(std::data(weights) + i)) };
+					const __m256 current{ _mm256_i32gather_ps(std::data(tree.distances), indices, 4) };
+					mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(candidates, current, _CMP_LT_OQ)));
+				}
+				else
+				{
+					const __m256i candidates
+					{
+						_mm256_add_epi32(_mm256_set1_epi32(distance), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(std::data(weights) + i)))
+					};
+					const __m256i current{ _mm256_i32gather_epi32(reinterpret_cast<const int*>(std::data(tree.distances)), indices, 4) };
+					mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(current, candidates))));
+				}
+
+				for (; mask != 0; mask &= mask - 1)
+				{
+					const auto lane{ i + static_cast<std::size_t>(std::countr_zero(mask)) };
+					relax_edge(tree, predecessor, distance, targets[lane], weights[lane], onImproved);
+				}
+			}
+		}
+#endif
+
+		for (; i < std::size(targets); ++i)
+		{
+			relax_edge(tree, predecessor, distance, targets[i], weights[i], onImproved);
+		}
+	}
+
+	template <class TTree>
+	void build_shortest_path_tree
+	(
+		TTree& tree,
+		std::size_t vertexCount,
+		const typename TTree::vertex_t& begin,
+		auto& neighborSearcher,
+		auto& weightCalculator
+	)
+	{
+		using vertex_t = typename TTree::vertex_t;
+		using weight_t = typename TTree::weight_t;
+		using entry_t = std::pair<weight_t, vertex_t>;
+
+		assert(static_cast<std::size_t>(begin) < vertexCount && "begin is out of range.");
+
+		tree.distances.assign(vertexCount, TTree::unreachable);
+		tree.parents.assign(vertexCount, TTree::no_parent);
+		tree.settleOrder.clear();
+
+		tree.distances[static_cast<std::size_t>(begin)] = weight_t{};
+		tree.parents[static_cast<std::size_t>(begin)] = begin;
+
+		// vertices are only pushed on strict improvements, thus each entry, whose distance no longer matches, is outdated
+		std::vector<entry_t> heap{ { weight_t{}, begin } };
+		while (!std::empty(heap))
+		{
+			std::ranges::pop_heap(heap, std::ranges::greater{});
+			const auto [distance, predecessor] = heap.back();
+			heap.pop_back();
+
+			if (distance != tree.distances[static_cast<std::size_t>(predecessor)])
+				continue;
+
+			tree.settleOrder.emplace_back(predecessor);
+			relax_out_edges
+			(
+				neighborSearcher,
+				weightCalculator,
+				tree,
+				predecessor,
+				[&](const vertex_t& cur_vertex, const weight_t& weight_sum)
+				{
+					heap.emplace_back(weight_sum, cur_vertex);
+					std::ranges::push_heap(heap, std::ranges::greater{});
+				}
+			);
+		}
+	}
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Computes the complete shortest-path-tree of the begin vertex and writes it into an existing tree.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \param tree The tree, which will be overwritten. Its arrays are reused, thus no allocation happens once they are large enough.
+	 * \details The resulting distances are identical to the distances reported by a complete ``traverse`` of an equally configured
+	 * ``dijkstra::search_params``.
+	 * \ingroup sssp
+	 */
+	template <class... TArgs>
+	void shortest_path_tree(sssp::search_params<TArgs...> params, typename sssp::search_params<TArgs...>::tree_t& tree)
+	{
+		detail::build_shortest_path_tree(tree, params.vertexCount, params.begin, params.neighborSearcher, params.weightCalculator);
+	}
+
+	/**
+	 * \brief Computes the complete shortest-path-tree of the begin vertex.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns the newly created tree.
+	 * \ingroup sssp
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	typename sssp::search_params<TArgs...>::tree_t shortest_path_tree(sssp::search_params<TArgs...> params)
+	{
+		typename sssp::search_params<TArgs...>::tree_t tree{};
+		shortest_path_tree(std::move(params), tree);
+		return tree;
+	}
+}
+
+#endif
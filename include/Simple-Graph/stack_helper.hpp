@@ -62,6 +62,35 @@ struct sl::graph::emplace_t<std::stack<TArgs...>>
 	}
 };
 
+/**
+ * \brief Specialization for std::stack.
+ * \tparam TArgs Template arguments for std::stack.
+ * \details Clears the underlying container, thus its allocated memory is kept if possible.
+ */
+template <class... TArgs>
+struct sl::graph::clear_t<std::stack<TArgs...>>
+{
+	using container_t = std::stack<TArgs...>;
+
+	/**
+	 * \brief The invocation operator. Removes all elements.
+	 * \param container The container object.
+	 */
+	constexpr void operator ()(container_t& container) const
+	{
+		// the underlying container is a protected member of all standard container adapters
+		struct accessor : container_t
+		{
+			static constexpr auto& underlying(container_t& adapter)
+			{
+				return adapter.*&accessor::c;
+			}
+		};
+
+		accessor::underlying(container).clear();
+	}
+};
+
 /** @}*/
 
 #endif
@@ -8,12 +8,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <compare>
 #include <concepts>
 #include <cstdint>
 #include <functional>
 #include <optional>
 #include <ranges>
+#include <type_traits>
 
 namespace sl::graph
 {
@@ -62,6 +65,24 @@ namespace sl::graph
 		visited
 	};
 
+	/**
+	 * \brief Determines how the algorithms with dynamic costs expand their nodes.
+	 */
+	enum class expansion_mode
+	{
+		/**
+		 * \brief Each neighbor is processed as soon as the neighbor searcher yields it.
+		 */
+		direct = 0,
+		/**
+		 * \brief The neighbors are collected into a batch and their state slots are prefetched, before the batch gets processed.
+		 * Additionally the adjacency of each visited vertex is prefetched as soon as it leaves the open list.
+		 * \details Pays off for large graphs with dense state maps, where most of the state accesses would miss the cache.
+		 * \see prefetch_t for the affected containers.
+		 */
+		prefetched
+	};
+
 	/**
 	 * \brief Checks whether a type satisfies the requirements for a vertex type.
 	 * \tparam T Type to check.
@@ -305,6 +326,99 @@ namespace sl::graph
 		emplace_t<std::remove_cvref_t<TContainer>>{}(container, std::forward<TCTorArgs>(args)...);
 	}
 
+	/**
+	 * \brief Basic helper type which serves as an abstraction, thus users may use their own container types.
+	 * \details This type may be specialized by users. The specialized type should at least contain the invoke operator
+	 * matching the following signature.
+	 * \code
+	 * void operator ()(container_t& container)
+	 * \endcode
+	 * The invoke operator must reset the container, thus it behaves like a newly constructed one, but should keep its
+	 * allocated memory if possible. Random access ranges (e.g. dense state maps) keep their size and each element gets
+	 * assigned a value initialized object. Other containers are cleared via their ``clear`` member function.
+	 * \tparam TContainer The container type.
+	 */
+	template <class TContainer>
+	struct clear_t
+	{
+		/**
+		 * \brief The invocation operator. Resets the container.
+		 * \param container The container object.
+		 */
+		constexpr void operator ()(TContainer& container) const
+			requires std::ranges::random_access_range<TContainer> || requires { container.clear(); }
+		{
+			if constexpr (std::ranges::random_access_range<TContainer>)
+			{
+				std::ranges::fill(container, std::ranges::range_value_t<TContainer>{});
+			}
+			else
+			{
+				container.clear();
+			}
+		}
+	};
+
+	/**
+	 * \brief Helper function which forwards its parameters to the appropriate clear_t specialization.
+	 * \tparam TContainer The container type.
+	 * \param container The container object.
+	 */
+	template <class TContainer>
+	constexpr void clear(TContainer& container)
+	{
+		clear_t<std::remove_cvref_t<TContainer>>{}(container);
+	}
+
+	/**
+	 * \brief Basic helper type which serves as an abstraction, thus users may use their own container types.
+	 * \details This type may be specialized by users. The specialized type should at least contain the invoke operator
+	 * matching the following signature.
+	 * \code
+	 * void operator ()(const container_t& container, const key_t& key)
+	 * \endcode
+	 * The invoke operator should hint the cpu to load the memory, which will be accessed for the given key, but must neither
+	 * modify the container nor insert any element. Contiguous ranges (e.g. dense state maps) prefetch the element at the
+	 * given index. For any other container this is a no-op.
+	 * \tparam TContainer The container type.
+	 * \see expansion_mode
+	 */
+	template <class TContainer>
+	struct prefetch_t
+	{
+		/**
+		 * \brief The invocation operator. Prefetches the element for the given key, if possible.
+		 * \param container The container object.
+		 * \param key The key object.
+		 */
+		template <class TKey>
+		constexpr void operator ()(const TContainer& container, const TKey& key) const noexcept
+		{
+			if constexpr (std::ranges::contiguous_range<const TContainer> && std::integral<TKey>)
+			{
+#if defined(__GNUC__) || defined(__clang__)
+				if (!std::is_constant_evaluated())
+				{
+					__builtin_prefetch(std::ranges::data(container) + key);
+				}
+#endif
+			}
+		}
+	};
+
+	/**
+	 * \brief Helper function which forwards its parameters to the appropriate prefetch_t specialization.
+	 * \tparam TContainer The container type.
+	 * \tparam TKey The key type.
+	 * \param container The container object.
+	 * \param key The key object.
+	 */
+	template <class TContainer, class TKey>
+	constexpr void prefetch(const TContainer& container, const TKey& key) noexcept
+	{
+		prefetch_t<std::remove_cvref_t<TContainer>>{}(container, key);
+	}
+
 	/** @}*/
 }
 
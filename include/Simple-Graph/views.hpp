@@ -0,0 +1,253 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_VIEWS_HPP
+#define SIMPLE_GRAPH_VIEWS_HPP
+
+#pragma once
+
+#include "astar.hpp"
+#include "breadth_first_search.hpp"
+#include "depth_first_search.hpp"
+#include "dijkstra.hpp"
+#include "generic_traverse.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <utility>
+
+namespace sl::graph::detail
+{
+	template <class TExpander>
+	class traversal_view
+		: public std::ranges::view_interface<traversal_view<TExpander>>
+	{
+	public:
+		using node_t = typename TExpander::node_t;
+
+		class iterator
+		{
+		public:
+			using iterator_concept = std::input_iterator_tag;
+			using value_type = node_t;
+			using difference_type = std::ptrdiff_t;
+
+			iterator() = default;
+
+			explicit iterator(traversal_view& view) noexcept
+				: m_View{ &view }
+			{
+			}
+
+			[[nodiscard]]
+			const node_t& operator *() const
+			{
+				assert(m_View && m_View->m_Current);
+				return *m_View->m_Current;
+			}
+
+			iterator& operator ++()
+			{
+				assert(m_View);
+				m_View->advance();
+				return *this;
+			}
+
+			void operator ++(int)
+			{
+				++*this;
+			}
+
+			[[nodiscard]]
+			friend bool operator ==(const iterator& itr, std::default_sentinel_t) noexcept
+			{
+				return itr.is_exhausted();
+			}
+
+		private:
+			traversal_view* m_View{};
+
+			[[nodiscard]]
+			bool is_exhausted() const noexcept
+			{
+				return !m_View || !m_View->m_Current;
+			}
+		};
+
+		explicit traversal_view(TExpander expander, node_t begin)
+			: m_Expander{ std::move(expander) }
+		{
+			m_Expander.discover(std::move(begin));
+		}
+
+		[[nodiscard]]
+		iterator begin()
+		{
+			if (!m_Current)
+				m_Current = m_Expander.next();
+			return iterator{ *this };
+		}
+
+		[[nodiscard]]
+		constexpr std::default_sentinel_t end() const noexcept
+		{
+			return {};
+		}
+
+	private:
+		TExpander m_Expander;
+		std::optional<node_t> m_Current{};
+
+		void advance()
+		{
+			assert(m_Current);
+			m_Expander.expand(*m_Current);
+			m_Current = m_Expander.next();
+		}
+	};
+
+	template <class TNode, class... TArgs>
+	[[nodiscard]]
+	auto make_uniform_cost_view(TNode begin, TArgs&&... args)
+	{
+		return traversal_view{ make_expander<uniform_cost_expander, TNode>(std::forward<TArgs>(args)...), std::move(begin) };
+	}
+
+	template <class TNode, class... TArgs>
+	[[nodiscard]]
+	auto make_dynamic_cost_view(TNode begin, TArgs&&... args)
+	{
+		return traversal_view{ make_expander<dynamic_cost_expander, TNode>(std::forward<TArgs>(args)...), std::move(begin) };
+	}
+}
+
+namespace sl::graph::views
+{
+	/** \addtogroup views
+	* @{
+	* \brief Provides lazy input ranges over the traversal order of the algorithms.
+	* \details Each view owns all components of the passed search_params and advances the traversal by exactly one node per
+	* increment. The neighbors of a node are discovered not until the iterator advances past it, thus leaving the loop early
+	* never touches any unnecessary vertex. In contrast to ``traverse``, there is no callback involved; the ``callback`` member
+	* of the passed search_params is simply ignored.
+	*
+	* The views are single pass and the iterators refer to their view, thus the view must outlive them. As long as all components
+	* of the search_params are movable, the views model ``std::ranges::view`` and can be composed with the standard range
+	* adaptors.
+	* \code
+	* for (const auto& node : views::dijkstra(params) | std::views::take(10))
+	* {
+	*	...
+	* }
+	* \endcode
+	*/
+
+	/**
+	 * \brief Creates a lazy view over the nodes in breadth first order.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns an input view of ``bfs::node_t``.
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	auto bfs(graph::bfs::search_params<TArgs...> params)
+	{
+		using params_t = graph::bfs::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::make_uniform_cost_view<node_t>
+		(
+			{ .vertex = std::move(params.begin) },
+			detail::make_weighted_node_factory<vertex_t>(constant_t<1>{}),
+			std::move(params.neighborSearcher),
+			std::move(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	/**
+	 * \brief Creates a lazy view over the nodes in depth first order.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns an input view of ``dfs::node_t``.
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	auto dfs(graph::dfs::search_params<TArgs...> params)
+	{
+		using params_t = graph::dfs::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::make_uniform_cost_view<node_t>
+		(
+			{ .vertex = std::move(params.begin) },
+			detail::make_weighted_node_factory<vertex_t>(constant_t<1>{}),
+			std::move(params.neighborSearcher),
+			std::move(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	/**
+	 * \brief Creates a lazy view over the nodes in the order they are finalized by the dijkstra algorithm.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns an input view of ``dijkstra::node_t``.
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	auto dijkstra(graph::dijkstra::search_params<TArgs...> params)
+	{
+		using params_t = graph::dijkstra::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::make_dynamic_cost_view<node_t>
+		(
+			{ .vertex = std::move(params.begin) },
+			detail::make_weighted_node_factory<vertex_t>(std::move(params.weightCalculator)),
+			std::move(params.neighborSearcher),
+			std::move(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	/**
+	 * \brief Creates a lazy view over the nodes in the order they are finalized by the astar algorithm.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns an input view of ``astar::node_t``.
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	auto astar(graph::astar::search_params<TArgs...> params)
+	{
+		using params_t = graph::astar::search_params<TArgs...>;
+		using vertex_t = typename params_t::vertex_t;
+		using node_t = typename params_t::node_t;
+
+		return detail::make_dynamic_cost_view<node_t>
+		(
+			{ .vertex = std::move(params.begin) },
+			detail::make_astar_node_factory<vertex_t>(std::move(params.weightCalculator), std::move(params.heuristic)),
+			std::move(params.neighborSearcher),
+			std::move(params.vertexPredicate),
+			std::move(params.stateMap),
+			std::move(params.openList)
+		);
+	}
+
+	/** @}*/
+}
+
+#endif
@@ -0,0 +1,201 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_WORKSPACE_HPP
+#define SIMPLE_GRAPH_WORKSPACE_HPP
+
+#pragma once
+
+#include "path_finder.hpp"
+#include "utility.hpp"
+
+#include <concepts>
+#include <functional>
+#include <map>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace sl::graph
+{
+	/**
+	 * \brief Owns all containers, which are required by a search, thus they can be reused by many consecutive searches.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TStateMap The state map type.
+	 * \tparam TOpenList The open list type.
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \details Pass a workspace to the ``traverse`` or ``find_path`` overloads of an algorithm and the containers of the
+	 * workspace are used instead of the prototypes of the search_params. Each of these calls clears the workspace in
+	 * beforehand, which keeps the memory of contiguous containers. Searches on a warmed up workspace therefore do not allocate
+	 * any more, as long as the state map and the predecessor map are dense random access containers (e.g. ``std::vector``
+	 * indexed by the vertices). The node based ``std::map`` defaults release their nodes on each ``clear`` and thus still
+	 * allocate for each visited vertex; only the open list and the path buffer are reused then.
+	 * \note Each algorithm provides a ``workspace_t`` alias with appropriate defaults. Alternatively use ``make_workspace``,
+	 * which deduces the types from a search_params object.
+	 */
+	template <vertex_descriptor TVertex, class TStateMap, class TOpenList, class TPredecessorMap>
+		requires predecessor_map_for<TPredecessorMap, TVertex>
+	struct search_workspace
+	{
+		/**
+		 * \brief Alias for the vertex type.
+		 */
+		using vertex_t = TVertex;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = TStateMap;
+
+		/**
+		 * \brief Alias for the open list type.
+		 */
+		using open_list_t = TOpenList;
+
+		/**
+		 * \brief Alias for the predecessor map type.
+		 */
+		using predecessor_map_t = TPredecessorMap;
+
+		/**
+		 * \brief The state map, which is used instead of the state map prototype of the search_params.
+		 * \attention Random access containers must already have their final size, as ``clear`` keeps their size.
+		 */
+		TStateMap stateMap{};
+
+		/**
+		 * \brief The open list, which is used instead of the open list prototype of the search_params.
+		 */
+		TOpenList openList{};
+
+		/**
+		 * \brief The predecessor map, which is used by the ``find_path`` overloads.
+		 * \attention Random access containers must already have their final size, as ``clear`` keeps their size.
+		 */
+		TPredecessorMap predecessorMap{};
+
+		/**
+		 * \brief The buffer, which holds the most recently found path.
+		 * \note The path is ordered from destination to begin, thus reversed.
+		 */
+		std::vector<TVertex> path{};
+
+		/**
+		 * \brief Resets all containers, but keeps their allocated memory.
+		 */
+		void clear()
+		{
+			graph::clear(stateMap);
+			graph::clear(openList);
+			graph::clear(predecessorMap);
+			path.clear();
+		}
+	};
+
+	/**
+	 * \brief Creates a workspace, whose containers are copies of the prototypes of the given search_params.
+	 * \tparam TParams The search_params type.
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \param params The search_params object.
+	 * \param predecessorMap The predecessor map prototype.
+	 * \return Returns the newly created workspace.
+	 */
+	template <
+		class TParams,
+		predecessor_map_for<typename TParams::vertex_t> TPredecessorMap
+		= std::map<typename TParams::vertex_t, std::optional<typename TParams::vertex_t>>>
+	[[nodiscard]]
+	auto make_workspace(const TParams& params, TPredecessorMap predecessorMap = {})
+	{
+		return search_workspace<
+			typename TParams::vertex_t,
+			typename TParams::state_map_t,
+			typename TParams::open_list_t,
+			TPredecessorMap>
+		{
+			.stateMap = params.stateMap,
+			.openList = params.openList,
+			.predecessorMap = std::move(predecessorMap)
+		};
+	}
+}
+
+namespace sl::graph::detail
+{
+	template <class TNode, class TWorkspace>
+	[[nodiscard]]
+	std::optional<node_vertex_t<TNode>> find_destination
+	(
+		auto& callback,
+		TWorkspace& workspace,
+		auto traverse_callback
+	)
+	{
+		static_assert
+		(
+			std::convertible_to<std::invoke_result_t<decltype(callback), const TNode&>, bool>,
+			"The return type of the provided callback must be boolean convertible."
+		);
+
+		workspace.clear();
+
+		std::optional<node_vertex_t<TNode>> destination{};
+		std::invoke
+		(
+			traverse_callback,
+			[&](const TNode& node)
+			{
+				workspace.predecessorMap[node.vertex] = node.predecessor;
+				if (!shall_interrupt(callback, node))
+					return false;
+
+				destination = node.vertex;
+				return true;
+			}
+		);
+		return destination;
+	}
+
+	template <class TNode, class TWorkspace>
+	[[nodiscard]]
+	std::optional<std::span<const node_vertex_t<TNode>>> extract_path_into
+	(
+		auto& callback,
+		TWorkspace& workspace,
+		auto traverse_callback
+	)
+	{
+		const std::optional destination{ find_destination<TNode>(callback, workspace, std::move(traverse_callback)) };
+		if (!destination)
+			return std::nullopt;
+
+		workspace.path.emplace_back(*destination);
+		for (auto predecessor = workspace.predecessorMap[*destination]; predecessor; predecessor = workspace.predecessorMap[*predecessor])
+		{
+			workspace.path.emplace_back(*predecessor);
+		}
+		return std::span<const node_vertex_t<TNode>>{ workspace.path };
+	}
+
+	template <class TNode, class TWorkspace>
+	[[nodiscard]]
+	std::optional<std::size_t> extract_path_into
+	(
+		auto& callback,
+		TWorkspace& workspace,
+		std::span<node_vertex_t<TNode>> buffer,
+		path_order order,
+		auto traverse_callback
+	)
+	{
+		const std::optional destination{ find_destination<TNode>(callback, workspace, std::move(traverse_callback)) };
+		if (!destination)
+			return std::nullopt;
+
+		return write_path(workspace.predecessorMap, *destination, buffer, order);
+	}
+}
+
+#endif
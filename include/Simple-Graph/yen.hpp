@@ -0,0 +1,455 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_YEN_HPP
+#define SIMPLE_GRAPH_YEN_HPP
+
+#pragma once
+
+#include "dijkstra.hpp"
+#include "generic_traverse.hpp"
+#include "path_finder.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace sl::graph::yen
+{
+	/** \addtogroup yen
+	* @{
+	* \brief Provides Yen's algorithm, which finds the k shortest loopless paths between two vertices.
+	* \details Each further path is derived from the previous ones by so called spur searches, which are plain dijkstra searches
+	* on a masked graph. The graph itself is never copied; the removed edges are masked via the vertex predicate, while the removed
+	* vertices are marked as already visited in the state map. All spur searches share one state map, predecessor map and open list,
+	* which are reset in between.
+	*/
+
+	/**
+	 * \brief The node type of the spur searches.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using node_t = dijkstra::node_t<TVertex, TWeight>;
+
+	/**
+	 * \brief The state type of the spur searches.
+	 */
+	template <weight TWeight>
+	using state_t = dijkstra::state_t<TWeight>;
+
+	/**
+	 * \brief The default open list type of the spur searches.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	using default_open_list_t = dijkstra::default_open_list_t<TVertex, TWeight>;
+
+	/**
+	 * \brief The type of the found paths.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TWeight The weight type.
+	 */
+	template <vertex_descriptor TVertex, weight TWeight>
+	struct path_t
+	{
+		/**
+		 * \brief The vertices of the path in reversed order (destination first).
+		 */
+		std::vector<TVertex> vertices{};
+
+		/**
+		 * \brief The cost of the path.
+		 */
+		TWeight weight_sum{};
+
+		[[nodiscard]]
+		constexpr bool operator ==(const path_t& other) const noexcept = default;
+	};
+
+	/**
+	 * \brief The search_params of the algorithm.
+	 * \tparam TVertex The vertex type.
+	 * \tparam TNeighborSearcher The neighbor searcher type.
+	 * \tparam TWeightCalculator The weight calculator type.
+	 * \tparam TCallback The callback type.
+	 * \tparam TVertexPredicate The vertex predicate type.
+	 * \tparam TStateMap The state map type.
+	 * \tparam TPredecessorMap The predecessor map type.
+	 * \tparam TOpenList The open list type.
+	 */
+	template <
+		vertex_descriptor TVertex,
+		neighbor_searcher_for<TVertex> TNeighborSearcher,
+		weight_calculator_for<TVertex> TWeightCalculator,
+		class TCallback = empty_invokable_t,
+		vertex_predicate_for<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TVertexPredicate = true_constant_t,
+		state_map_for<TVertex, state_t<detail::weight_type_of_t<TWeightCalculator, TVertex>>> TStateMap
+		= std::map<TVertex, state_t<detail::weight_type_of_t<TWeightCalculator, TVertex>>>,
+		predecessor_map_for<TVertex> TPredecessorMap = std::map<TVertex, std::optional<TVertex>>,
+		open_list_for<node_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>> TOpenList
+		= default_open_list_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>>
+		requires std::invocable<TCallback, const path_t<TVertex, detail::weight_type_of_t<TWeightCalculator, TVertex>>&>
+	struct search_params
+	{
+		/**
+		 * \brief Alias for the actual value type of the vertex.
+		 */
+		using vertex_t = std::remove_cvref_t<TVertex>;
+
+		/**
+		 * \brief Alias for the actual weight type of the weight.
+		 */
+		using weight_t = detail::weight_type_of_t<TWeightCalculator, TVertex>;
+
+		/**
+		 * \brief Alias for the node type.
+		 */
+		using node_t = weighted_node<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the path type.
+		 */
+		using path_t = yen::path_t<vertex_t, weight_t>;
+
+		/**
+		 * \brief Alias for the neighbor searcher type.
+		 */
+		using neighbor_searcher_t = TNeighborSearcher;
+
+		/**
+		 * \brief Alias for the weight calculator type.
+		 */
+		using weight_calculator_t = TWeightCalculator;
+
+		/**
+		 * \brief Alias for the callback type.
+		 */
+		using callback_t = TCallback;
+
+		/**
+		 * \brief Alias for the vertex predicate type.
+		 */
+		using vertex_predicate_t = TVertexPredicate;
+
+		/**
+		 * \brief Alias for the state map type.
+		 */
+		using state_map_t = std::remove_cvref_t<TStateMap>;
+
+		/**
+		 * \brief Alias for the predecessor map type.
+		 */
+		using predecessor_map_t = std::remove_cvref_t<TPredecessorMap>;
+
+		/**
+		 * \brief Alias for the open list type.
+		 */
+		using open_list_t = std::remove_cvref_t<TOpenList>;
+
+		/**
+		 * \brief The vertex to start the search.
+		 */
+		TVertex begin{};
+
+		/**
+		 * \brief The vertex to be reached.
+		 */
+		TVertex destination{};
+
+		/**
+		 * \brief The neighbor searcher to be used. Must be an invokable type, which returns a range of vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * range<vertex_t> operator()(const vertex_t& current)
+		 * \endcode
+		 * where ``range<vertex_t>`` must satisfy the requirements of a ``std::ranges::input_range`` type.
+		 */
+		TNeighborSearcher neighborSearcher{};
+
+		/**
+		 * \brief The weight calculator to be used. Must be an invokable type, which returns the weight between two adjacent vertices.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * weight_t operator()(const vertex_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * \attention The returned value must never be less than zero.
+		 */
+		TWeightCalculator weightCalculator{};
+
+		/**
+		 * \brief The maximal amount of paths to be found.
+		 */
+		std::size_t pathCount{ 1 };
+
+		/**
+		 * \brief The callback object to be invoked for each found path, ordered by non-decreasing cost.
+		 * \remark If not set, an empty_invokable_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * void operator()(const path_t& path)
+		 * \endcode
+		 *
+		 * Alternatively the invoke operator may return a boolean-convertible type, where true indicates that the algorithm shall
+		 * be aborted.
+		 */
+		TCallback callback{};
+
+		/**
+		 * \brief The predicate, which will be invoked for each discovered vertex.
+		 * \remark If not set, an true_constant_t object is used.
+		 * \details The signature of the invocation operator should match the following:
+		 * \code
+		 * bool operator()(const node_t& predecessor, const vertex_t& current)
+		 * \endcode
+		 * The predicates determines whether a vertex shall be further investigated, where false means it will be skipped.
+		 * The ``weight_sum`` of the provided node is always relative to the begin vertex.
+		 */
+		TVertexPredicate vertexPredicate{};
+
+		/**
+		 * \brief The state map, which is shared by all spur searches.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \details Between two spur searches the state map gets reset via ``clear``.
+		 * \see state_map_for concept for the actual type requirements.
+		 */
+		TStateMap stateMap{};
+
+		/**
+		 * \brief The predecessor map, which is shared by all spur searches.
+		 * \note If not explicitly set, a ``std::map```is used, thus the vertex type must be less-comparable.
+		 * \details Between two spur searches the predecessor map gets reset via ``clear``.
+		 */
+		TPredecessorMap predecessorMap{};
+
+		/**
+		 * \brief The open list, which is shared by all spur searches.
+		 * \note If not explicitly set, a ``std::priority_queue`` is used.
+		 * \details Between two spur searches the open list gets reset via ``clear``.
+		 * \see open_list_for concept for the actual type requirements.
+		 */
+		TOpenList openList{};
+	};
+
+	/** @}*/
+}
+
+namespace sl::graph::detail
+{
+	template <class TParams>
+	class yen_engine
+	{
+	public:
+		using vertex_t = typename TParams::vertex_t;
+		using weight_t = typename TParams::weight_t;
+		using node_t = typename TParams::node_t;
+		using path_t = typename TParams::path_t;
+
+		explicit yen_engine(TParams& params)
+			: m_Params{ params }
+		{
+		}
+
+		void run()
+		{
+			if (m_Params.pathCount == 0)
+				return;
+
+			const vertex_t begin[]{ m_Params.begin };
+			const weight_t beginWeightSum[]{ weight_t{} };
+			if (!spur_search(begin, beginWeightSum))
+				return;
+
+			while (!std::empty(m_Candidates))
+			{
+				std::ranges::pop_heap(m_Candidates, std::greater{}, &candidate_t::key);
+				m_Accepted.emplace_back(std::move(m_Candidates.back()));
+				m_Candidates.pop_back();
+
+				if (shall_interrupt(m_Params.callback, make_path(m_Accepted.back()))
+					|| std::size(m_Accepted) == m_Params.pathCount)
+					return;
+
+				generate_candidates(std::size(m_Accepted) - 1);
+			}
+		}
+
+	private:
+		// paths are stored in forward order, where each vertex is accompanied by the cost of reaching it
+		struct candidate_t
+		{
+			std::vector<vertex_t> vertices{};
+			std::vector<weight_t> weightSums{};
+
+			// shorter paths are preferred on equal costs
+			[[nodiscard]]
+			std::tuple<weight_t, std::size_t> key() const
+			{
+				return { weightSums.back(), std::size(vertices) };
+			}
+		};
+
+		TParams& m_Params;
+		std::vector<candidate_t> m_Accepted{};
+		std::vector<candidate_t> m_Candidates{};
+		std::vector<vertex_t> m_BlockedSuccessors{};
+
+		[[nodiscard]]
+		static path_t make_path(const candidate_t& candidate)
+		{
+			return
+			{
+				.vertices = { std::rbegin(candidate.vertices), std::rend(candidate.vertices) },
+				.weight_sum = candidate.weightSums.back()
+			};
+		}
+
+		void generate_candidates(std::size_t acceptedIndex)
+		{
+			const candidate_t& last{ m_Accepted[acceptedIndex] };
+			for (std::size_t i{ 0 }; i + 1 < std::size(last.vertices); ++i)
+			{
+				const std::span root{ std::data(last.vertices), i + 1 };
+
+				// the next edges of all accepted paths sharing the same root must be avoided
+				m_BlockedSuccessors.clear();
+				for (const candidate_t& accepted : m_Accepted)
+				{
+					if (i + 1 < std::size(accepted.vertices) && std::ranges::equal(root, std::span{ std::data(accepted.vertices), i + 1 }))
+					{
+						m_BlockedSuccessors.emplace_back(accepted.vertices[i + 1]);
+					}
+				}
+
+				spur_search(root, std::span{ std::data(last.weightSums), i + 1 });
+			}
+		}
+
+		// the root contains all vertices in front of the spur vertex and the spur vertex itself
+		bool spur_search(std::span<const vertex_t> root, std::span<const weight_t> rootWeightSums)
+		{
+			assert(!std::empty(root) && std::size(root) == std::size(rootWeightSums));
+
+			clear(m_Params.stateMap);
+			clear(m_Params.predecessorMap);
+			clear(m_Params.openList);
+
+			// root vertices must not be part of the spur path, thus they are treated as already visited
+			const vertex_t& spur{ root.back() };
+			for (const vertex_t& v : root.first(std::size(root) - 1))
+			{
+				m_Params.stateMap[v] = dynamic_cost_state_t<weight_t>{ visit_state::visited, weight_t{} };
+			}
+
+			bool found{ false };
+			dynamic_cost_traverse<node_t>
+			(
+				make_weighted_node_factory<vertex_t>(std::ref(m_Params.weightCalculator)),
+				node_t{ .vertex = spur, .weight_sum = rootWeightSums.back() },
+				std::ref(m_Params.neighborSearcher),
+				[&](const node_t& node)
+				{
+					m_Params.predecessorMap[node.vertex] = node.predecessor;
+					found = node.vertex == m_Params.destination;
+					return found;
+				},
+				[&](const node_t& predecessor, const vertex_t& v)
+				{
+					if (predecessor.vertex == spur && std::ranges::find(m_BlockedSuccessors, v) != std::end(m_BlockedSuccessors))
+						return false;
+					return static_cast<bool>(std::invoke(m_Params.vertexPredicate, predecessor, v));
+				},
+				m_Params.stateMap,
+				m_Params.openList
+			);
+
+			if (!found)
+				return false;
+
+			candidate_t candidate{};
+			for (auto v = std::optional{ m_Params.destination }; v; v = m_Params.predecessorMap[*v])
+			{
+				candidate.vertices.emplace_back(*v);
+				candidate.weightSums.emplace_back(std::get<1>(m_Params.stateMap[*v]));
+			}
+			std::ranges::reverse(candidate.vertices);
+			std::ranges::reverse(candidate.weightSums);
+
+			candidate.vertices.insert(std::begin(candidate.vertices), std::begin(root), std::prev(std::end(root)));
+			candidate.weightSums.insert(std::begin(candidate.weightSums), std::begin(rootWeightSums), std::prev(std::end(rootWeightSums)));
+
+			if (std::ranges::any_of(m_Candidates, [&](const candidate_t& other) { return other.vertices == candidate.vertices; }))
+				return false;
+
+			m_Candidates.emplace_back(std::move(candidate));
+			std::ranges::push_heap(m_Candidates, std::greater{}, &candidate_t::key);
+			return true;
+		}
+	};
+}
+
+namespace sl::graph
+{
+	/**
+	 * \brief Overload for yen::search_params.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \details The search stops after ``pathCount`` paths have been published, the callback requested the abort or no further
+	 * loopless path exists.
+	 * \ingroup yen
+	 */
+	template <class... TArgs>
+	void traverse(yen::search_params<TArgs...> params)
+	{
+		detail::yen_engine{ params }.run();
+	}
+
+	/**
+	 * \brief Executes the algorithm and returns the found paths.
+	 * \tparam TArgs Template arguments for the search_params.
+	 * \param params The search_params object.
+	 * \return Returns at most ``pathCount`` loopless paths, ordered by non-decreasing cost.
+	 * \details The callback is still invoked for each found path.
+	 * \ingroup yen
+	 */
+	template <class... TArgs>
+	[[nodiscard]]
+	std::vector<typename yen::search_params<TArgs...>::path_t> find_paths(yen::search_params<TArgs...> params)
+	{
+		using path_t = typename yen::search_params<TArgs...>::path_t;
+
+		std::vector<path_t> result{};
+		auto callback = std::move(params.callback);
+		traverse
+		(
+			yen::search_params
+			{
+				.begin = std::move(params.begin),
+				.destination = std::move(params.destination),
+				.neighborSearcher = std::ref(params.neighborSearcher),
+				.weightCalculator = std::ref(params.weightCalculator),
+				.pathCount = params.pathCount,
+				.callback = [&](const path_t& path)
+				{
+					result.emplace_back(path);
+					return detail::shall_interrupt(callback, path);
+				},
+				.vertexPredicate = std::ref(params.vertexPredicate),
+				.stateMap = std::move(params.stateMap),
+				.predecessorMap = std::move(params.predecessorMap),
+				.openList = std::move(params.openList)
+			}
+		);
+		return result;
+	}
+}
+
+#endif
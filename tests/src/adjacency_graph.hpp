@@ -0,0 +1,78 @@
+//          Copyright Dominic Koepke 2022 - 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SIMPLE_GRAPH_TESTS_ADJACENCY_GRAPH_HPP
+#define SIMPLE_GRAPH_TESTS_ADJACENCY_GRAPH_HPP
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+// shared by the tests and benchmarks; thus it must not depend on any of the test-only packages
+// simple directed graph with dense vertex ids; each vertex holds its outgoing edges as (target, weight) pairs
+struct adjacency_graph
+{
+	std::vector<std::vector<std::pair<int, int>>> edges{};
+};
+
+inline adjacency_graph make_random_graph(int vertexCount, int edgesPerVertex, int maxWeight, unsigned seed)
+{
+	std::mt19937 rng{ seed };
+	std::uniform_int_distribution<int> vertexDist{ 0, vertexCount - 1 };
+	std::uniform_int_distribution<int> weightDist{ 1, maxWeight };
+
+	adjacency_graph graph{ std::vector<std::vector<std::pair<int, int>>>(vertexCount) };
+	for (auto& edges : graph.edges)
+	{
+		for (int i = 0; i < edgesPerVertex; ++i)
+		{
+			const int target = vertexDist(rng);
+			if (std::ranges::find(edges, target, &std::pair<int, int>::first) == std::end(edges))
+				edges.emplace_back(target, weightDist(rng));
+		}
+	}
+	return graph;
+}
+
+// each edge points into the opposite direction, thus a search on the transposed graph yields the distances towards its begin
+inline adjacency_graph make_transposed_graph(const adjacency_graph& graph)
+{
+	adjacency_graph transposed{ std::vector<std::vector<std::pair<int, int>>>(std::size(graph.edges)) };
+	for (std::size_t v{ 0 }; v < std::size(graph.edges); ++v)
+	{
+		for (const auto& [target, weight] : graph.edges[v])
+		{
+			transposed.edges[target].emplace_back(static_cast<int>(v), weight);
+		}
+	}
+	return transposed;
+}
+
+struct adjacency_graph_neighbor_searcher
+{
+	const adjacency_graph* graph{};
+
+	auto operator ()(const int& v) const
+	{
+		return graph->edges[v] | std::views::keys;
+	}
+};
+
+struct adjacency_graph_weight_extractor
+{
+	const adjacency_graph* graph{};
+
+	int operator ()(const int& predecessor, const int& current) const
+	{
+		return std::ranges::find(graph->edges[predecessor], current, &std::pair<int, int>::first)->second;
+	}
+};
+
+#endif
@@ -0,0 +1,166 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/alt.hpp"
+#include "Simple-Graph/astar.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+namespace
+{
+	alt::landmark_table_t<int, int> make_table
+	(
+		const adjacency_graph& graph,
+		std::size_t landmarkCount,
+		alt::selection_strategy strategy,
+		std::size_t threadCount
+	)
+	{
+		return build_landmarks
+		(
+			alt::build_params
+			{
+				.graph = make_csr_graph<int>
+				(
+					std::size(graph.edges),
+					adjacency_graph_neighbor_searcher{ &graph },
+					adjacency_graph_weight_extractor{ &graph }
+				),
+				.landmarkCount = landmarkCount,
+				.strategy = strategy,
+				.seed = 42,
+				.threadCount = threadCount
+			}
+		);
+	}
+}
+
+TEST_CASE("build_landmarks should select distinct landmarks.", "[alt]")
+{
+	const auto strategy = GENERATE(alt::selection_strategy::farthest, alt::selection_strategy::avoid);
+
+	const adjacency_graph graph{ make_random_graph(200, 3, 20, 1337) };
+	const auto table = make_table(graph, 8, strategy, 1);
+
+	std::vector<int> landmarks(std::begin(table.landmarks()), std::end(table.landmarks()));
+	REQUIRE(std::size(landmarks) == 8);
+	std::ranges::sort(landmarks);
+	REQUIRE(std::ranges::adjacent_find(landmarks) == std::end(landmarks));
+}
+
+TEST_CASE("build_landmarks should select different landmarks with the avoid and the farthest strategy.", "[alt]")
+{
+	const adjacency_graph graph{ make_random_graph(500, 3, 20, 1337) };
+	const auto farthestTable = make_table(graph, 8, alt::selection_strategy::farthest, 1);
+	const auto avoidTable = make_table(graph, 8, alt::selection_strategy::avoid, 1);
+
+	// the initial landmark is chosen differently anyway; the following ones must not degrade to the farthest selection
+	const std::vector<int> farthest(std::begin(farthestTable.landmarks()) + 1, std::end(farthestTable.landmarks()));
+	const std::vector<int> avoid(std::begin(avoidTable.landmarks()) + 1, std::end(avoidTable.landmarks()));
+	REQUIRE(std::ranges::count_if(avoid, [&](const int v) { return std::ranges::find(farthest, v) == std::end(farthest); }) > 0);
+}
+
+TEST_CASE("build_landmarks should store the exact landmark distances.", "[alt]")
+{
+	const std::size_t threadCount = GENERATE(1u, 4u);
+
+	const adjacency_graph graph{ make_random_graph(200, 3, 20, 1337) };
+	const adjacency_graph transposedGraph{ make_transposed_graph(graph) };
+	const auto table = make_table(graph, 6, alt::selection_strategy::avoid, threadCount);
+
+	for (std::size_t i{ 0 }; i < std::size(table.landmarks()); ++i)
+	{
+		const int landmark{ table.landmarks()[i] };
+		const auto fromLandmark = dijkstra_distances(graph, landmark);
+		const auto toLandmark = dijkstra_distances(transposedGraph, landmark);
+		for (int v{ 0 }; v < 200; ++v)
+		{
+			REQUIRE(table.distance_from_landmark(i, v) == fromLandmark[v].value_or(table.infinity));
+			REQUIRE(table.distance_to_landmark(i, v) == toLandmark[v].value_or(table.infinity));
+		}
+	}
+}
+
+TEST_CASE("alt heuristic should never overestimate the distance.", "[alt]")
+{
+	const auto strategy = GENERATE(alt::selection_strategy::farthest, alt::selection_strategy::avoid);
+	const std::size_t activeLandmarkCount = GENERATE(1u, 4u, 100u);
+
+	const adjacency_graph graph{ make_random_graph(300, 3, 20, 42) };
+	const adjacency_graph transposedGraph{ make_transposed_graph(graph) };
+	const auto table = make_table(graph, 8, strategy, 2);
+
+	for (int destination{ 0 }; destination < 300; destination += 37)
+	{
+		const auto heuristic = alt::make_heuristic(table, 0, destination, activeLandmarkCount);
+		REQUIRE(std::size(heuristic.active_landmarks()) == std::min<std::size_t>(activeLandmarkCount, 8));
+
+		const auto toDestination = dijkstra_distances(transposedGraph, destination);
+		for (int v{ 0 }; v < 300; ++v)
+		{
+			if (const std::optional distance = toDestination[v])
+			{
+				REQUIRE(heuristic(v) <= *distance);
+			}
+		}
+	}
+}
+
+TEST_CASE("astar with alt heuristic should find shortest paths with less expansions than dijkstra.", "[alt][astar]")
+{
+	const adjacency_graph graph{ make_random_graph(500, 3, 20, 1337) };
+	const auto table = make_table(graph, 16, alt::selection_strategy::avoid, 2);
+
+	std::size_t astarExpansions{ 0 };
+	std::size_t dijkstraExpansions{ 0 };
+	for (int destination{ 1 }; destination < 500; destination += 41)
+	{
+		const auto expectedDistance = dijkstra_distances(graph, 0)[destination];
+
+		std::optional<int> distance{};
+		traverse
+		(
+			astar::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+				.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+				.heuristic = alt::make_heuristic(table, 0, destination),
+				.callback = [&](const auto& node)
+				{
+					++astarExpansions;
+					if (node.vertex != destination)
+						return false;
+					distance = node.weight_sum;
+					return true;
+				}
+			}
+		);
+		REQUIRE(distance == expectedDistance);
+
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+				.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+				.callback = [&](const auto& node)
+				{
+					++dijkstraExpansions;
+					return node.vertex == destination;
+				}
+			}
+		);
+	}
+
+	REQUIRE(astarExpansions < dijkstraExpansions);
+}
@@ -0,0 +1,210 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/ara_star.hpp"
+#include "Simple-Graph/astar.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+#include <unordered_map>
+
+using namespace sl::graph;
+
+namespace
+{
+	std::optional<int> dijkstra_distance(const cost_grid& grid, int begin, int destination)
+	{
+		std::optional<int> distance{};
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+				.weightCalculator = cost_grid_weight_extractor{ &grid },
+				.callback = [&](const auto& node)
+				{
+					if (node.vertex == destination)
+					{
+						distance = node.weight_sum;
+						return true;
+					}
+					return false;
+				}
+			}
+		);
+		return distance;
+	}
+
+	struct manhattan_heuristic
+	{
+		const cost_grid* grid{};
+		int destination{};
+
+		int operator ()(int v) const
+		{
+			return std::abs(v % grid->width - destination % grid->width) + std::abs(v / grid->width - destination / grid->width);
+		}
+	};
+
+	int path_cost(const cost_grid& grid, const std::vector<int>& path)
+	{
+		int cost{ 0 };
+		for (std::size_t i{ 1 }; i < std::size(path); ++i)
+		{
+			const std::vector<int> neighbors{ cost_grid_neighbor_searcher{ &grid }(path[i]) };
+			REQUIRE(std::ranges::find(neighbors, path[i - 1]) != std::end(neighbors));
+			cost += grid.costs[path[i - 1]];
+		}
+		return cost;
+	}
+}
+
+TEST_CASE("inflated_heuristic_t should multiply the wrapped estimation.", "[astar][ara_star]")
+{
+	constexpr astar::inflated_heuristic_t inflated{ .heuristic = [](int v) { return v; }, .factor = 2.5 };
+
+	STATIC_REQUIRE(inflated(0) == 0);
+	STATIC_REQUIRE(inflated(2) == 5);
+	STATIC_REQUIRE(inflated(3) == 7);
+}
+
+TEST_CASE("astar with inflated_heuristic_t should find bounded suboptimal paths.", "[astar][ara_star]")
+{
+	const double factor = GENERATE(1., 1.5, 3.);
+
+	cost_grid grid{ make_random_grid(40, 40, 42) };
+	const int begin{ 0 };
+	const int destination{ 40 * 40 - 1 };
+	grid.costs[begin] = 1;
+	grid.costs[destination] = 1;
+
+	const std::optional path = find_path
+	(
+		astar::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.heuristic = astar::inflated_heuristic_t{ manhattan_heuristic{ &grid, destination }, factor },
+			.callback = [&](const auto& node) { return node.vertex == destination; }
+		},
+		std::map<int, std::optional<int>>{}
+	);
+
+	const std::optional expected = dijkstra_distance(grid, begin, destination);
+	REQUIRE(path.has_value() == expected.has_value());
+	if (path)
+	{
+		REQUIRE(path_cost(grid, *path) <= *expected * factor);
+	}
+}
+
+TEST_CASE("ara_star should publish improving paths until the optimal one.", "[ara_star]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+	const double initialEpsilon = GENERATE(1., 2., 5.);
+
+	cost_grid grid{ make_random_grid(48, 48, seed) };
+	const int begin{ 49 };
+	const int destination{ 48 * 46 + 46 };
+	grid.costs[begin] = 1;
+	grid.costs[destination] = 1;
+
+	std::vector<ara_star::solution_t<int, int>> solutions{};
+	traverse
+	(
+		ara_star::search_params
+		{
+			.begin = begin,
+			.destination = destination,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.heuristic = manhattan_heuristic{ &grid, destination },
+			.callback = [&](const ara_star::solution_t<int, int>& solution) { solutions.emplace_back(solution); },
+			.stateMap = std::unordered_map<int, ara_star::state_t<int, int>>{},
+			.initialEpsilon = initialEpsilon,
+			.epsilonStep = 0.5
+		}
+	);
+
+	const std::optional expected = dijkstra_distance(grid, begin, destination);
+	REQUIRE(std::empty(solutions) == !expected.has_value());
+	if (expected)
+	{
+		for (std::size_t i{ 0 }; i < std::size(solutions); ++i)
+		{
+			const auto& [path, weightSum, epsilon] = solutions[i];
+			REQUIRE(path.front() == destination);
+			REQUIRE(path.back() == begin);
+			REQUIRE(path_cost(grid, path) == weightSum);
+			REQUIRE(weightSum <= *expected * epsilon + 0.0001);
+			if (0 < i)
+			{
+				REQUIRE(weightSum <= solutions[i - 1].weight_sum);
+				REQUIRE(epsilon <= solutions[i - 1].epsilon);
+				REQUIRE((weightSum < solutions[i - 1].weight_sum || epsilon < solutions[i - 1].epsilon));
+			}
+		}
+
+		REQUIRE(solutions.back().epsilon == 1.);
+		REQUIRE(solutions.back().weight_sum == *expected);
+	}
+}
+
+TEST_CASE("ara_star should abort if the callback returns true.", "[ara_star]")
+{
+	cost_grid grid{ 30, 30, std::vector<int>(30 * 30, 1) };
+	for (int i{ 0 }; i < 25; ++i)
+	{
+		grid.costs[15 * 30 + i] = 5;
+	}
+
+	int invocations{ 0 };
+	const std::optional solution = find_path
+	(
+		ara_star::search_params
+		{
+			.begin = 0,
+			.destination = 30 * 30 - 1,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.heuristic = manhattan_heuristic{ &grid, 30 * 30 - 1 },
+			.callback = [&](const auto&) { return ++invocations == 1; },
+			.initialEpsilon = 5.
+		}
+	);
+
+	REQUIRE(invocations == 1);
+	REQUIRE(solution);
+	REQUIRE(path_cost(grid, solution->path) == solution->weight_sum);
+}
+
+TEST_CASE("ara_star should not publish anything if the destination is unreachable.", "[ara_star]")
+{
+	cost_grid grid{ 10, 10, std::vector<int>(10 * 10, 1) };
+	for (int i{ 0 }; i < 10; ++i)
+	{
+		grid.costs[5 * 10 + i] = 0;
+	}
+
+	const std::optional solution = find_path
+	(
+		ara_star::search_params
+		{
+			.begin = 0,
+			.destination = 99,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.heuristic = manhattan_heuristic{ &grid, 99 }
+		}
+	);
+
+	REQUIRE(!solution);
+}
@@ -0,0 +1,212 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/batch.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+#include <atomic>
+#include <map>
+#include <random>
+
+using namespace sl::graph;
+
+namespace
+{
+	std::vector<batch::query_t<int>> make_random_queries(int vertexCount, int queryCount, unsigned seed)
+	{
+		std::mt19937 rng{ seed };
+		std::uniform_int_distribution<int> vertexDist{ 0, vertexCount - 1 };
+
+		std::vector<batch::query_t<int>> queries{};
+		for (int i = 0; i < queryCount; ++i)
+		{
+			queries.push_back({ .begin = vertexDist(rng), .destination = vertexDist(rng) });
+		}
+		return queries;
+	}
+
+	// returns the cost of the reversed path; or -1, if the path does not match the query or uses non-existing edges
+	int path_cost(const adjacency_graph& graph, const std::vector<int>& path, const batch::query_t<int>& query)
+	{
+		if (std::empty(path) || path.front() != query.destination || path.back() != query.begin)
+			return -1;
+
+		int cost{ 0 };
+		for (std::size_t i = std::size(path) - 1; 0 < i; --i)
+		{
+			const auto& edges = graph.edges[path[i]];
+			const auto edge = std::ranges::find(edges, path[i - 1], &std::pair<int, int>::first);
+			if (edge == std::end(edges))
+				return -1;
+			cost += edge->second;
+		}
+		return cost;
+	}
+
+	std::optional<int> expected_cost(const adjacency_graph& graph, const batch::query_t<int>& query)
+	{
+		const auto path = find_path
+		(
+			dijkstra::search_params
+			{
+				.begin = query.begin,
+				.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+				.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+				.callback = vertex_destination_t<int>{ query.destination }
+			},
+			std::map<int, std::optional<int>>{}
+		);
+
+		if (!path)
+			return std::nullopt;
+		return path_cost(graph, *path, query);
+	}
+}
+
+TEST_CASE("work_stealing_for should invoke the provided function exactly once per index.", "[batch]")
+{
+	const std::size_t threadCount = GENERATE(1u, 2u, 3u, 8u);
+	const std::size_t count = GENERATE(0u, 1u, 7u, 1000u);
+
+	std::vector<std::atomic<int>> invocations(count);
+	std::atomic<bool> validThreadIndices{ true };
+	detail::work_stealing_for
+	(
+		threadCount,
+		count,
+		[&](const std::size_t threadIndex, const std::size_t i)
+		{
+			if (threadCount <= threadIndex)
+				validThreadIndices = false;
+			++invocations[i];
+		}
+	);
+
+	REQUIRE(validThreadIndices);
+	REQUIRE(std::ranges::all_of(invocations, [](const std::atomic<int>& counter) { return counter == 1; }));
+}
+
+TEST_CASE("batch::find_paths should find the shortest path for each query.", "[batch]")
+{
+	const unsigned seed = GENERATE(1u, 2u, 3u);
+	const std::size_t threadCount = GENERATE(1u, 3u, 0u);
+
+	const adjacency_graph graph{ make_random_graph(80, 2, 9, seed) };
+	const std::vector<batch::query_t<int>> queries{ make_random_queries(80, 200, seed) };
+
+	const auto paths = find_paths
+	(
+		batch::search_params
+		{
+			.queries = std::span{ queries },
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.threadCount = threadCount
+		}
+	);
+
+	REQUIRE(std::size(paths) == std::size(queries));
+	for (std::size_t i = 0; i < std::size(queries); ++i)
+	{
+		const std::optional<int> expectedCost{ expected_cost(graph, queries[i]) };
+		REQUIRE(paths[i].has_value() == expectedCost.has_value());
+		if (paths[i])
+			REQUIRE(path_cost(graph, *paths[i], queries[i]) == *expectedCost);
+	}
+}
+
+TEST_CASE("batch::find_paths should support dense state and predecessor maps.", "[batch]")
+{
+	const std::size_t threadCount = GENERATE(1u, 4u);
+
+	constexpr int vertexCount{ 50 };
+	const adjacency_graph graph{ make_random_graph(vertexCount, 2, 9, 42) };
+	const std::vector<batch::query_t<int>> queries{ make_random_queries(vertexCount, 100, 42) };
+
+	const auto paths = find_paths
+	(
+		batch::search_params
+		{
+			.queries = std::span{ queries },
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.stateMap = std::vector<batch::state_t<int>>(vertexCount),
+			.predecessorMap = std::vector<std::optional<int>>(vertexCount),
+			.threadCount = threadCount
+		}
+	);
+
+	for (std::size_t i = 0; i < std::size(queries); ++i)
+	{
+		const std::optional<int> expectedCost{ expected_cost(graph, queries[i]) };
+		REQUIRE(paths[i].has_value() == expectedCost.has_value());
+		if (paths[i])
+			REQUIRE(path_cost(graph, *paths[i], queries[i]) == *expectedCost);
+	}
+}
+
+TEST_CASE("batch::find_paths should invoke the heuristic factory with the destination of each query.", "[batch]")
+{
+	const adjacency_graph graph{ make_random_graph(30, 3, 9, 7) };
+	const std::vector<batch::query_t<int>> queries{ make_random_queries(30, 50, 7) };
+
+	std::atomic<int> factoryInvocations{ 0 };
+	const auto paths = find_paths
+	(
+		batch::search_params
+		{
+			.queries = std::span{ queries },
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.heuristicFactory = [&](const int& destination)
+			{
+				++factoryInvocations;
+				return [destination](const int& v) { return v == destination ? 0 : 1; };
+			},
+			.threadCount = 2
+		}
+	);
+
+	REQUIRE(factoryInvocations == std::ssize(queries));
+	for (std::size_t i = 0; i < std::size(queries); ++i)
+	{
+		const std::optional<int> expectedCost{ expected_cost(graph, queries[i]) };
+		REQUIRE(paths[i].has_value() == expectedCost.has_value());
+		if (paths[i])
+			REQUIRE(path_cost(graph, *paths[i], queries[i]) == *expectedCost);
+	}
+}
+
+TEST_CASE("batch::find_paths should overwrite each element of the provided output.", "[batch]")
+{
+	// 0 -> 1 -> 2, while 3 is isolated
+	const adjacency_graph graph{ { { { 1, 1 } }, { { 2, 1 } }, {}, {} } };
+	const std::vector<batch::query_t<int>> queries{ { 0, 2 }, { 0, 3 }, { 1, 1 } };
+
+	std::vector<std::optional<std::vector<int>>> results{ std::vector<int>{ 9, 9, 9, 9 }, std::vector<int>{ 9 }, std::nullopt };
+	results[0]->reserve(64);
+	const int* const reusedBuffer{ std::data(*results[0]) };
+
+	find_paths
+	(
+		batch::search_params
+		{
+			.queries = std::span{ queries },
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+		},
+		std::span{ results }
+	);
+
+	REQUIRE(results[0] == std::vector{ 2, 1, 0 });
+	REQUIRE(std::data(*results[0]) == reusedBuffer);
+	REQUIRE(!results[1]);
+	REQUIRE(results[2] == std::vector{ 1 });
+}
@@ -0,0 +1,133 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/astar.hpp"
+#include "Simple-Graph/bounded_open_list.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+TEST_CASE("bounded_open_list should take the least node next.", "[bounded_open_list]")
+{
+	bounded_open_list<int> openList{ 10 };
+	for (const int value : { 5, 3, 8, 1, 9, 3 })
+	{
+		emplace(openList, value);
+	}
+
+	std::vector<int> values{};
+	while (!openList.empty())
+	{
+		values.emplace_back(take_next(openList));
+	}
+
+	REQUIRE(values == std::vector{ 1, 3, 3, 5, 8, 9 });
+}
+
+TEST_CASE("bounded_open_list should prune the worst nodes.", "[bounded_open_list]")
+{
+	open_list_statistics statistics{};
+	bounded_open_list<int> openList{ 3, &statistics };
+	for (const int value : { 5, 3, 8, 1, 9, 2 })
+	{
+		emplace(openList, value);
+	}
+
+	REQUIRE(openList.size() == 3);
+	REQUIRE(statistics == open_list_statistics{ .insertions = 6, .pruned = 3, .peakSize = 3 });
+
+	std::vector<int> values{};
+	while (!openList.empty())
+	{
+		values.emplace_back(take_next(openList));
+	}
+
+	REQUIRE(values == std::vector{ 1, 2, 3 });
+}
+
+TEST_CASE("bounded_open_list should respect the comparison object.", "[bounded_open_list]")
+{
+	bounded_open_list<int, std::greater<>> openList{ 2 };
+	for (const int value : { 5, 3, 8, 1 })
+	{
+		emplace(openList, value);
+	}
+
+	REQUIRE(take_next(openList) == 8);
+	REQUIRE(take_next(openList) == 5);
+	REQUIRE(openList.empty());
+}
+
+TEST_CASE("dijkstra with sufficiently large bounded_open_list should behave like the default.", "[bounded_open_list][dijkstra]")
+{
+	using node_t = dijkstra::node_t<int, int>;
+
+	const cost_grid grid{ make_random_grid(32, 32, 1337) };
+	const int begin{ static_cast<int>(std::ranges::find_if(grid.costs, [](int cost) { return cost != 0; }) - std::begin(grid.costs)) };
+
+	open_list_statistics statistics{};
+	const auto expected = dijkstra_distances(std::size(grid.costs), begin, cost_grid_neighbor_searcher{ &grid }, cost_grid_weight_extractor{ &grid }, dijkstra::default_open_list_t<int, int>{});
+	const auto distances = dijkstra_distances(std::size(grid.costs), begin, cost_grid_neighbor_searcher{ &grid }, cost_grid_weight_extractor{ &grid }, bounded_open_list<node_t>{ 32 * 32, &statistics });
+
+	REQUIRE(distances == expected);
+	REQUIRE(statistics.pruned == 0);
+	REQUIRE(0 < statistics.insertions);
+}
+
+TEST_CASE("dijkstra with small bounded_open_list should only prune the search.", "[bounded_open_list][dijkstra]")
+{
+	using node_t = dijkstra::node_t<int, int>;
+
+	const cost_grid grid{ make_random_grid(32, 32, 1337) };
+	const int begin{ static_cast<int>(std::ranges::find_if(grid.costs, [](int cost) { return cost != 0; }) - std::begin(grid.costs)) };
+
+	open_list_statistics statistics{};
+	const auto expected = dijkstra_distances(std::size(grid.costs), begin, cost_grid_neighbor_searcher{ &grid }, cost_grid_weight_extractor{ &grid }, dijkstra::default_open_list_t<int, int>{});
+	const auto distances = dijkstra_distances(std::size(grid.costs), begin, cost_grid_neighbor_searcher{ &grid }, cost_grid_weight_extractor{ &grid }, bounded_open_list<node_t>{ 4, &statistics });
+
+	REQUIRE(0 < statistics.pruned);
+	REQUIRE(statistics.peakSize == 4);
+	for (std::size_t i{ 0 }; i < std::size(distances); ++i)
+	{
+		if (distances[i])
+		{
+			REQUIRE(expected[i]);
+			REQUIRE(*expected[i] <= *distances[i]);
+		}
+	}
+}
+
+TEST_CASE("astar with bounded_open_list should find paths through open grids.", "[bounded_open_list][astar]")
+{
+	using node_t = astar::node_t<int, int>;
+
+	const std::size_t beamWidth = GENERATE(1u, 8u, 64u);
+	const cost_grid grid{ 40, 40, std::vector<int>(40 * 40, 1) };
+	constexpr int destination{ 40 * 40 - 1 };
+
+	open_list_statistics statistics{};
+	const std::optional path = find_path
+	(
+		astar::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.heuristic = [](int v) { return 39 - v % 40 + 39 - v / 40; },
+			.callback = [](const auto& node) { return node.vertex == destination; },
+			.openList = bounded_open_list<node_t>{ beamWidth, &statistics }
+		},
+		std::map<int, std::optional<int>>{}
+	);
+
+	REQUIRE(path);
+	REQUIRE(std::size(*path) == 79);
+	REQUIRE(statistics.peakSize <= beamWidth);
+}
@@ -0,0 +1,121 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/contraction_hierarchy.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+namespace
+{
+	ch::build_params<int, int> make_build_params(const adjacency_graph& graph, std::size_t threadCount)
+	{
+		return
+		{
+			.graph = make_csr_graph<int>
+			(
+				std::size(graph.edges),
+				adjacency_graph_neighbor_searcher{ &graph },
+				adjacency_graph_weight_extractor{ &graph }
+			),
+			.threadCount = threadCount
+		};
+	}
+}
+
+TEST_CASE("build_hierarchy should assign a unique rank to each vertex.", "[contraction_hierarchy]")
+{
+	const adjacency_graph graph{ make_random_graph(200, 3, 10, 42) };
+
+	const auto hierarchy = build_hierarchy(make_build_params(graph, 2));
+
+	REQUIRE(hierarchy.vertex_count() == 200);
+	std::vector<std::size_t> ranks{ hierarchy.ranks };
+	std::ranges::sort(ranks);
+	for (std::size_t i{ 0 }; i < std::size(ranks); ++i)
+	{
+		REQUIRE(ranks[i] == i);
+	}
+
+	for (int v{ 0 }; v < 200; ++v)
+	{
+		for (const int& w : hierarchy.upward.neighbors(v))
+		{
+			REQUIRE(hierarchy.ranks[v] < hierarchy.ranks[w]);
+		}
+		for (const int& u : hierarchy.downward.neighbors(v))
+		{
+			REQUIRE(hierarchy.ranks[v] < hierarchy.ranks[u]);
+		}
+	}
+}
+
+TEST_CASE("ch query should find the trivial path.", "[contraction_hierarchy][find_path]")
+{
+	const adjacency_graph graph{ make_random_graph(10, 2, 10, 42) };
+	const auto hierarchy = build_hierarchy(make_build_params(graph, 1));
+
+	REQUIRE(find_path(hierarchy, 3, 3) == std::vector{ 3 });
+	REQUIRE(ch::query_t{ hierarchy }.distance(3, 3) == 0);
+}
+
+TEST_CASE("ch query should report unreachable destinations.", "[contraction_hierarchy][find_path]")
+{
+	const adjacency_graph graph
+	{
+		{
+			{ { 1, 1 } },
+			{},
+			{ { 0, 1 } }
+		}
+	};
+	const auto hierarchy = build_hierarchy(make_build_params(graph, 1));
+
+	REQUIRE(find_path(hierarchy, 2, 1) == std::vector{ 1, 0, 2 });
+	REQUIRE(!find_path(hierarchy, 1, 2));
+	REQUIRE(!ch::query_t{ hierarchy }.distance(0, 2));
+}
+
+TEST_CASE("ch query should yield the same distances as dijkstra.", "[contraction_hierarchy][find_path]")
+{
+	const std::size_t threadCount = GENERATE(1u, 4u);
+	const std::size_t witnessSettleLimit = GENERATE(3u, 500u);
+
+	const adjacency_graph graph{ make_random_graph(150, 3, 20, 1337) };
+	auto params = make_build_params(graph, threadCount);
+	params.witnessSettleLimit = witnessSettleLimit;
+	const auto hierarchy = build_hierarchy(params);
+
+	ch::query_t query{ hierarchy };
+	for (int begin{ 0 }; begin < 150; begin += 19)
+	{
+		const auto expectedDistances = dijkstra_distances(graph, begin);
+		for (int destination{ 0 }; destination < 150; ++destination)
+		{
+			REQUIRE(query.distance(begin, destination) == expectedDistances[destination]);
+
+			const auto path = query.find_path(begin, destination);
+			REQUIRE(path.has_value() == expectedDistances[destination].has_value());
+			if (path)
+			{
+				REQUIRE(path->front() == destination);
+				REQUIRE(path->back() == begin);
+
+				// the unpacked path must only consist of original edges
+				int length{ 0 };
+				for (std::size_t i{ 1 }; i < std::size(*path); ++i)
+				{
+					length += adjacency_graph_weight_extractor{ &graph }((*path)[i], (*path)[i - 1]);
+				}
+				REQUIRE(length == expectedDistances[destination]);
+			}
+		}
+	}
+}
@@ -0,0 +1,65 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Simple-Graph/csr_graph.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+TEST_CASE("make_csr_graph should store all edges of the neighbor searcher.", "[csr_graph]")
+{
+	const adjacency_graph graph
+	{
+		{
+			{ { 1, 3 }, { 2, 5 } },
+			{ { 2, 1 } },
+			{},
+			{ { 0, 7 } }
+		}
+	};
+
+	const auto csr = make_csr_graph<int>
+	(
+		std::size(graph.edges),
+		adjacency_graph_neighbor_searcher{ &graph },
+		adjacency_graph_weight_extractor{ &graph }
+	);
+
+	REQUIRE(std::same_as<decltype(csr), const csr_graph<int, int>>);
+	REQUIRE(csr.vertex_count() == 4);
+	REQUIRE(csr.edge_count() == 4);
+	REQUIRE(csr.offsets == std::vector<std::size_t>{ 0, 2, 3, 3, 4 });
+	REQUIRE(std::ranges::equal(csr.neighbors(0), std::vector{ 1, 2 }));
+	REQUIRE(std::ranges::equal(csr.neighbor_weights(0), std::vector{ 3, 5 }));
+	REQUIRE(std::empty(csr.neighbors(2)));
+	REQUIRE(csr.edge_weight(3, 0) == 7);
+	REQUIRE(!csr.edge_weight(0, 3));
+}
+
+TEST_CASE("transpose should reverse all edges.", "[csr_graph]")
+{
+	const adjacency_graph graph{ make_random_graph(50, 3, 10, 42) };
+	const auto csr = make_csr_graph<int>
+	(
+		std::size(graph.edges),
+		adjacency_graph_neighbor_searcher{ &graph },
+		adjacency_graph_weight_extractor{ &graph }
+	);
+
+	const auto transposed = transpose(csr);
+
+	REQUIRE(transposed.vertex_count() == csr.vertex_count());
+	REQUIRE(transposed.edge_count() == csr.edge_count());
+	for (int v{ 0 }; v < 50; ++v)
+	{
+		for (const auto& [target, weight] : graph.edges[v])
+		{
+			REQUIRE(transposed.edge_weight(target, v) == weight);
+		}
+	}
+}
@@ -0,0 +1,127 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/customizable_contraction_hierarchy.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+namespace
+{
+	cch::topology_t<int, int> make_topology(const adjacency_graph& graph)
+	{
+		return build_topology
+		(
+			cch::build_params
+			{
+				.graph = make_csr_graph<int>
+				(
+					std::size(graph.edges),
+					adjacency_graph_neighbor_searcher{ &graph },
+					adjacency_graph_weight_extractor{ &graph }
+				)
+			}
+		);
+	}
+
+	struct hashed_weight_calculator
+	{
+		int operator ()(const int& predecessor, const int& current) const
+		{
+			return (predecessor * 7 + current * 13) % 17;
+		}
+	};
+}
+
+TEST_CASE("cch customization should correctly expose its typedefs.", "[customizable_contraction_hierarchy]")
+{
+	const adjacency_graph graph{ make_random_graph(10, 2, 10, 42) };
+	const auto topology = make_topology(graph);
+
+	const cch::customization_params params
+	{
+		.topology = &topology,
+		.weightCalculator = hashed_weight_calculator{}
+	};
+	using params_t = decltype(params);
+
+	REQUIRE(std::same_as<params_t::vertex_t, int>);
+	REQUIRE(std::same_as<params_t::weight_t, int>);
+	REQUIRE(std::same_as<params_t::weight_calculator_t, hashed_weight_calculator>);
+	REQUIRE(std::same_as<params_t::hierarchy_t, ch::hierarchy_t<int, int>>);
+}
+
+TEST_CASE("cch topology should contain all original edges.", "[customizable_contraction_hierarchy]")
+{
+	const adjacency_graph graph{ make_random_graph(200, 3, 10, 42) };
+	const auto topology = make_topology(graph);
+
+	REQUIRE(topology.vertex_count() == 200);
+
+	const auto hierarchy = customize(cch::customization_params{ .topology = &topology, .weightCalculator = constant_t<1>{} });
+	for (int v{ 0 }; v < 200; ++v)
+	{
+		for (const int& w : graph.edges[v] | std::views::keys | std::views::filter([&](const int& x) { return x != v; }))
+		{
+			const bool isUpward{ hierarchy.ranks[v] < hierarchy.ranks[w] };
+			const auto& neighbors = isUpward ? hierarchy.upward.neighbors(v) : hierarchy.downward.neighbors(w);
+			REQUIRE(std::ranges::find(neighbors, isUpward ? w : v) != std::end(neighbors));
+		}
+	}
+}
+
+TEST_CASE("customized cch should yield the same distances as dijkstra.", "[customizable_contraction_hierarchy][find_path]")
+{
+	const std::size_t threadCount = GENERATE(1u, 4u);
+
+	const adjacency_graph graph{ make_random_graph(300, 3, 20, 1337) };
+	const auto topology = make_topology(graph);
+
+	const auto check = [&](const auto& hierarchy, const auto& weightCalculator)
+	{
+		ch::query_t query{ hierarchy };
+		for (int begin{ 0 }; begin < 300; begin += 43)
+		{
+			const auto expectedDistances = dijkstra_distances(std::size(graph.edges), begin, adjacency_graph_neighbor_searcher{ &graph }, weightCalculator);
+			for (int destination{ 0 }; destination < 300; destination += 5)
+			{
+				REQUIRE(query.distance(begin, destination) == expectedDistances[destination]);
+
+				const auto path = query.find_path(begin, destination);
+				REQUIRE(path.has_value() == expectedDistances[destination].has_value());
+				if (path)
+				{
+					REQUIRE(path->front() == destination);
+					REQUIRE(path->back() == begin);
+
+					// the unpacked path must only consist of original edges
+					std::optional<int> length{ 0 };
+					for (std::size_t i{ 1 }; length && i < std::size(*path); ++i)
+					{
+						const int& from = (*path)[i];
+						const int& to = (*path)[i - 1];
+						if (std::ranges::find(graph.edges[from], to, &std::pair<int, int>::first) == std::end(graph.edges[from]))
+							length.reset();
+						else
+							*length += weightCalculator(from, to);
+					}
+					REQUIRE(length == expectedDistances[destination]);
+				}
+			}
+		}
+	};
+
+	// the same topology is customized with different metrics
+	const adjacency_graph_weight_extractor firstMetric{ &graph };
+	check(customize(cch::customization_params{ .topology = &topology, .weightCalculator = firstMetric, .threadCount = threadCount }), firstMetric);
+
+	const hashed_weight_calculator secondMetric{};
+	check(customize(cch::customization_params{ .topology = &topology, .weightCalculator = secondMetric, .threadCount = threadCount }), secondMetric);
+}
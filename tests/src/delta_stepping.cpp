@@ -0,0 +1,138 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/delta_stepping.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+
+#include "helper.hpp"
+
+#include <stdexcept>
+
+using namespace sl::graph;
+
+TEST_CASE("delta_stepping should correctly expose its typedefs.", "[delta_stepping]")
+{
+	const adjacency_graph graph{};
+
+	const delta_stepping::search_params params
+	{
+		.begin = 0,
+		.vertexCount = 0,
+		.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+		.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+	};
+	using params_t = decltype(params);
+
+	REQUIRE(std::same_as<params_t::vertex_t, int>);
+	REQUIRE(std::same_as<params_t::weight_t, int>);
+	REQUIRE(std::same_as<params_t::neighbor_searcher_t, adjacency_graph_neighbor_searcher>);
+	REQUIRE(std::same_as<params_t::weight_calculator_t, adjacency_graph_weight_extractor>);
+	REQUIRE(std::same_as<params_t::result_t, delta_stepping::result_t<int, int>>);
+}
+
+TEST_CASE("delta_stepping should compute the distances of a linear graph.", "[delta_stepping]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 6 };
+
+	const auto result = shortest_paths
+	(
+		delta_stepping::search_params
+		{
+			.begin = 2,
+			.vertexCount = end,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = [](int, int current) { return current; },
+			.delta = 3
+		}
+	);
+
+	REQUIRE(result.distances == std::vector<std::optional<int>>{ 1, 1, 0, 3, 7, 12 });
+	REQUIRE(result.predecessors == std::vector<std::optional<int>>{ 1, 2, std::nullopt, 2, 3, 4 });
+}
+
+TEST_CASE("delta_stepping should report unreachable vertices as std::nullopt.", "[delta_stepping]")
+{
+	const adjacency_graph graph{ { { { 1, 4 } }, {}, { { 0, 1 } } } };
+
+	const auto result = shortest_paths
+	(
+		delta_stepping::search_params
+		{
+			.begin = 0,
+			.vertexCount = 3,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+		}
+	);
+
+	REQUIRE(result.distances == std::vector<std::optional<int>>{ 0, 4, std::nullopt });
+	REQUIRE(result.predecessors == std::vector<std::optional<int>>{ std::nullopt, 0, std::nullopt });
+}
+
+TEST_CASE("delta_stepping should yield the same distances as dijkstra.", "[delta_stepping]")
+{
+	const std::size_t threadCount = GENERATE(1u, 2u, 4u);
+	const int delta = GENERATE(1, 5, 50);
+
+	const adjacency_graph graph{ make_random_graph(500, 4, 20, 1337) };
+	const auto expectedDistances = dijkstra_distances(graph, 0);
+
+	const auto result = shortest_paths
+	(
+		delta_stepping::search_params
+		{
+			.begin = 0,
+			.vertexCount = std::size(graph.edges),
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.delta = delta,
+			.threadCount = threadCount
+		}
+	);
+
+	REQUIRE(result.distances == expectedDistances);
+	for (std::size_t v{ 0 }; v < std::size(graph.edges); ++v)
+	{
+		if (const auto& predecessor = result.predecessors[v])
+		{
+			REQUIRE(result.distances[*predecessor]);
+			REQUIRE(*result.distances[v] == *result.distances[*predecessor] + adjacency_graph_weight_extractor{ &graph }(*predecessor, static_cast<int>(v)));
+		}
+	}
+}
+
+TEST_CASE("delta_stepping should rethrow exceptions of the weight calculator on the calling thread.", "[delta_stepping]")
+{
+	const std::size_t threadCount = GENERATE(1u, 2u, 4u);
+	const int throwingVertex = GENERATE(0, 1, 2, 3);
+
+	const adjacency_graph graph{ make_random_graph(100, 4, 20, 1337) };
+	const adjacency_graph_weight_extractor weightExtractor{ &graph };
+
+	REQUIRE_THROWS_AS
+	(
+		shortest_paths
+		(
+			delta_stepping::search_params
+			{
+				.begin = 0,
+				.vertexCount = std::size(graph.edges),
+				.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+				.weightCalculator = [&](int predecessor, int current)
+				{
+					if (static_cast<std::size_t>(predecessor) % threadCount == static_cast<std::size_t>(throwingVertex) % threadCount)
+						throw std::runtime_error{ "weight calculator failed" };
+					return weightExtractor(predecessor, current);
+				},
+				.threadCount = threadCount
+			}
+		),
+		std::runtime_error
+	);
+}
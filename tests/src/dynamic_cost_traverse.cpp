@@ -8,11 +8,18 @@
 #include <catch2/matchers/catch_matchers_vector.hpp>
 
 #include "Simple-Graph/astar.hpp"
+#include "Simple-Graph/csr_graph.hpp"
 #include "Simple-Graph/dijkstra.hpp"
 
 #include "helper.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
 #include <set>
+#include <span>
+#include <stop_token>
+#include <tuple>
 
 using namespace sl::graph;
 
@@ -248,6 +255,66 @@ TEST_CASE("Test dijkstra traverse compiling with as much default params as possi
 	traverse(searcher);
 }
 
+TEST_CASE("dijkstra should stop at the next check, after a stop has been requested.", "[dijkstra][traverse]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 100 };
+
+	const auto [stopCheckInterval, expectedVisits] = GENERATE
+	(
+		table<std::size_t, int>({
+			{ 1, 5 },
+			{ 4, 7 },
+			{ 5, 9 }
+			})
+	);
+
+	std::stop_source stopSource{};
+	int visits{ 0 };
+	traverse
+	(
+		dijkstra::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.callback = [&](const auto&)
+			{
+				if (++visits == 5)
+					stopSource.request_stop();
+			},
+			.stopToken = stopSource.get_token(),
+			.stopCheckInterval = stopCheckInterval
+		}
+	);
+
+	REQUIRE(visits == expectedVisits);
+}
+
+TEST_CASE("dijkstra find_path should return std::nullopt, if stopped before reaching the destination.", "[dijkstra][find_path]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 100 };
+
+	std::stop_source stopSource{};
+	stopSource.request_stop();
+
+	const auto path = find_path
+	(
+		dijkstra::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.callback = vertex_destination_t<int>{ 99 },
+			.stopToken = stopSource.get_token()
+		},
+		std::map<int, std::optional<int>>{}
+	);
+
+	REQUIRE(!path);
+}
+
 TEST_CASE("dijkstra find_path should return reversed path as vector if exists.", "[dijkstra][find_path]")
 {
 	using node_t = weighted_node<vertex, int>;
@@ -285,6 +352,323 @@ TEST_CASE("dijkstra find_path should return reversed path as vector if exists.",
 	REQUIRE(path == expectedPath);
 }
 
+TEST_CASE("dijkstra find_paths should return reversed paths for each target.", "[dijkstra][find_path]")
+{
+	constexpr grid2d<int, 3, 4> grid
+	{
+		{
+			{ 1, 2, 1 },
+			{ 1, 1, 1 },
+			{ 1, 4, 1 },
+			{ 1, 2, 1 }
+		}
+	};
+
+	const dijkstra::search_params searcher
+	{
+		.begin = vertex{ 1, 1 },
+		.neighborSearcher = grid_4way_neighbor_searcher{ .grid = &grid },
+		.weightCalculator = grid_weight_extractor{ .grid = &grid },
+		.stateMap = state_map_t{}
+	};
+
+	const auto paths = find_paths
+	(
+		searcher,
+		std::vector<vertex>{ { 2, 3 }, { 3, 3 }, { 1, 1 }, { 2, 3 } },
+		std::map<vertex, std::optional<vertex>, vertex_less>{}
+	);
+
+	REQUIRE(std::size(paths) == 4);
+	REQUIRE(paths[0] == std::vector<vertex>{ { 2, 3 }, { 2, 2 }, { 2, 1 }, { 1, 1 } });
+	REQUIRE(!paths[1]); // out of grid bounds
+	REQUIRE(paths[2] == std::vector<vertex>{ { 1, 1 } });
+	REQUIRE(paths[3] == paths[0]);
+}
+
+TEST_CASE("dijkstra find_paths should yield the same paths as find_path.", "[dijkstra][find_path]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+
+	const cost_grid grid{ make_random_grid(24, 24, seed) };
+	const int begin{ static_cast<int>(std::ranges::find_if(grid.costs, [](int cost) { return cost != 0; }) - std::begin(grid.costs)) };
+
+	std::mt19937 gen{ seed };
+	std::vector<int> targets(20);
+	std::ranges::generate(targets, [&] { return std::uniform_int_distribution{ 0, 24 * 24 - 1 }(gen); });
+
+	std::size_t expansions{ 0 };
+	const auto paths = find_paths
+	(
+		dijkstra::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.callback = [&](const auto&) { ++expansions; }
+		},
+		targets
+	);
+
+	REQUIRE(std::size(paths) == std::size(targets));
+	for (std::size_t i{ 0 }; i < std::size(targets); ++i)
+	{
+		const std::optional expected = find_path
+		(
+			dijkstra::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+				.weightCalculator = cost_grid_weight_extractor{ &grid },
+				.callback = [&](const auto& node) { return node.vertex == targets[i]; }
+			},
+			std::map<int, std::optional<int>>{}
+		);
+
+		REQUIRE(paths[i].has_value() == expected.has_value());
+		if (paths[i])
+		{
+			const auto path_cost = [&](const std::vector<int>& path)
+			{
+				return std::accumulate(std::begin(path), std::prev(std::end(path)), 0, [&](int sum, int v) { return sum + grid.costs[v]; });
+			};
+			REQUIRE(paths[i]->front() == targets[i]);
+			REQUIRE(paths[i]->back() == begin);
+			REQUIRE(path_cost(*paths[i]) == path_cost(*expected));
+		}
+	}
+	REQUIRE(0 < expansions);
+}
+
+TEST_CASE("dijkstra find_path with workspace should yield the same paths as find_path.", "[dijkstra][find_path]")
+{
+	const cost_grid grid{ make_random_grid(24, 24, 42) };
+	constexpr int vertexCount{ 24 * 24 };
+
+	const auto dijkstra_params = [&](const int begin, const int destination)
+	{
+		return dijkstra::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.callback = vertex_destination_t<int>{ destination }
+		};
+	};
+
+	dijkstra::workspace_t<int, int, std::vector<dijkstra::state_t<int>>, dijkstra::default_open_list_t<int, int>, std::vector<std::optional<int>>> workspace
+	{
+		.stateMap = std::vector<dijkstra::state_t<int>>(vertexCount),
+		.predecessorMap = std::vector<std::optional<int>>(vertexCount)
+	};
+	workspace.path.reserve(vertexCount);
+	const int* const pathBuffer{ std::data(workspace.path) };
+
+	std::mt19937 gen{ 42 };
+	std::uniform_int_distribution vertexDist{ 0, vertexCount - 1 };
+	for (int i{ 0 }; i < 50; ++i)
+	{
+		const int begin{ vertexDist(gen) };
+		const int destination{ vertexDist(gen) };
+
+		const std::optional expected = find_path(dijkstra_params(begin, destination), std::map<int, std::optional<int>>{});
+		const std::optional path = find_path(dijkstra_params(begin, destination), workspace);
+
+		REQUIRE(path.has_value() == expected.has_value());
+		if (path)
+			REQUIRE(std::ranges::equal(*path, *expected));
+		REQUIRE(std::data(workspace.path) == pathBuffer);
+	}
+}
+
+TEST_CASE("dijkstra find_path with default workspace should yield the same paths as find_path.", "[dijkstra][find_path]")
+{
+	const cost_grid grid{ make_random_grid(24, 24, 42) };
+	constexpr int vertexCount{ 24 * 24 };
+
+	const auto dijkstra_params = [&](const int begin, const int destination)
+	{
+		return dijkstra::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.callback = vertex_destination_t<int>{ destination }
+		};
+	};
+
+	// the node based default maps are emptied on each clear, thus only the path buffer keeps its memory
+	dijkstra::workspace_t<int, int> workspace{};
+	workspace.path.reserve(vertexCount);
+	const int* const pathBuffer{ std::data(workspace.path) };
+
+	std::mt19937 gen{ 42 };
+	std::uniform_int_distribution vertexDist{ 0, vertexCount - 1 };
+	for (int i{ 0 }; i < 50; ++i)
+	{
+		const int begin{ vertexDist(gen) };
+		const int destination{ vertexDist(gen) };
+
+		const std::optional expected = find_path(dijkstra_params(begin, destination));
+		const std::optional path = find_path(dijkstra_params(begin, destination), workspace);
+
+		REQUIRE(path.has_value() == expected.has_value());
+		if (path)
+			REQUIRE(std::ranges::equal(*path, *expected));
+		REQUIRE(std::data(workspace.path) == pathBuffer);
+		REQUIRE(std::size(workspace.predecessorMap) <= static_cast<std::size_t>(vertexCount));
+	}
+}
+
+TEST_CASE("dijkstra find_path with buffer should write the same paths as find_path in the requested order.", "[dijkstra][find_path]")
+{
+	const cost_grid grid{ make_random_grid(24, 24, 42) };
+	constexpr int vertexCount{ 24 * 24 };
+
+	const auto dijkstra_params = [&](const int begin, const int destination)
+	{
+		return dijkstra::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.callback = vertex_destination_t<int>{ destination }
+		};
+	};
+
+	auto workspace = make_workspace(dijkstra_params(0, 0));
+	std::vector<int> buffer(vertexCount);
+	const path_order order = GENERATE(path_order::reversed, path_order::forward);
+
+	std::mt19937 gen{ 1337 };
+	std::uniform_int_distribution vertexDist{ 0, vertexCount - 1 };
+	for (int i{ 0 }; i < 50; ++i)
+	{
+		const int begin{ vertexDist(gen) };
+		const int destination{ vertexDist(gen) };
+
+		std::optional expected = find_path(dijkstra_params(begin, destination));
+		const std::optional length = find_path(dijkstra_params(begin, destination), workspace, buffer, order);
+
+		REQUIRE(length.has_value() == expected.has_value());
+		if (length)
+		{
+			if (order == path_order::forward)
+				std::ranges::reverse(*expected);
+			REQUIRE(*length == std::size(*expected));
+			REQUIRE(std::ranges::equal(std::span{ buffer }.first(*length), *expected));
+		}
+	}
+}
+
+TEST_CASE("dijkstra find_path with buffer should not write anything, if the buffer is too small.", "[dijkstra][find_path]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 20 };
+
+	const dijkstra::search_params params
+	{
+		.begin = 2,
+		.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+		.weightCalculator = constant_t<1>{},
+		.callback = vertex_destination_t<int>{ 9 }
+	};
+	auto workspace = make_workspace(params);
+
+	std::vector<int> buffer(7, -1);
+	REQUIRE(find_path(params, workspace, buffer) == 8);
+	REQUIRE(std::ranges::count(buffer, -1) == 7);
+
+	buffer.resize(8);
+	REQUIRE(find_path(params, workspace, buffer, path_order::forward) == 8);
+	REQUIRE(buffer == std::vector{ 2, 3, 4, 5, 6, 7, 8, 9 });
+}
+
+TEST_CASE("dijkstra traverse with workspace should not be affected by previous interrupted searches.", "[dijkstra][traverse]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 20 };
+
+	const auto make_params = [&](auto callback)
+	{
+		return dijkstra::search_params
+		{
+			.begin = 10,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.callback = std::move(callback)
+		};
+	};
+
+	auto workspace = make_workspace(make_params(empty_invokable_t{}));
+
+	int visits{ 0 };
+	traverse(make_params([&](const auto&) { return ++visits == 3; }), workspace);
+	REQUIRE(visits == 3);
+	REQUIRE(!std::empty(workspace.openList));
+
+	visits = 0;
+	traverse(make_params([&](const auto&) { ++visits; }), workspace);
+	REQUIRE(visits == end - begin);
+}
+
+TEST_CASE("dijkstra and astar should visit the same nodes in prefetched expansion mode.", "[dijkstra][astar][traverse]")
+{
+	const unsigned seed = GENERATE(1u, 2u, 3u);
+	constexpr int vertexCount{ 500 };
+	const adjacency_graph graph{ make_random_graph(vertexCount, 4, 9, seed) };
+	const auto csrGraph = make_csr_graph<int>
+	(
+		vertexCount,
+		adjacency_graph_neighbor_searcher{ &graph },
+		adjacency_graph_weight_extractor{ &graph }
+	);
+
+	const auto dijkstra_visits = [&](const expansion_mode mode, auto stateMap)
+	{
+		std::vector<std::tuple<std::optional<int>, int, int>> visits{};
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = csr_neighbor_searcher{ &csrGraph },
+				.weightCalculator = csr_weight_calculator{ &csrGraph },
+				.callback = [&](const auto& node) { visits.emplace_back(node.predecessor, node.vertex, node.weight_sum); },
+				.stateMap = std::move(stateMap),
+				.expansionMode = mode
+			}
+		);
+		return visits;
+	};
+
+	const auto astar_visits = [&](const expansion_mode mode)
+	{
+		std::vector<std::tuple<std::optional<int>, int, int>> visits{};
+		traverse
+		(
+			astar::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+				.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+				.heuristic = [](const int v) { return v % 3; },
+				.callback = [&](const auto& node) { visits.emplace_back(node.predecessor, node.vertex, node.weight_sum); },
+				.stateMap = std::vector<astar::state_t<int>>(vertexCount),
+				.expansionMode = mode
+			}
+		);
+		return visits;
+	};
+
+	const auto expectedDijkstraVisits = dijkstra_visits(expansion_mode::direct, std::vector<dijkstra::state_t<int>>(vertexCount));
+	REQUIRE(std::size(expectedDijkstraVisits) <= vertexCount);
+	REQUIRE(dijkstra_visits(expansion_mode::prefetched, std::vector<dijkstra::state_t<int>>(vertexCount)) == expectedDijkstraVisits);
+	REQUIRE(dijkstra_visits(expansion_mode::prefetched, std::map<int, dijkstra::state_t<int>>{}) == expectedDijkstraVisits);
+
+	REQUIRE(astar_visits(expansion_mode::prefetched) == astar_visits(expansion_mode::direct));
+}
+
 TEST_CASE("astar should correctly expose its typedefs.", "[astar]")
 {
 	constexpr grid2d<int, 3, 4> grid{};
@@ -0,0 +1,221 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Simple-Graph/astar.hpp"
+#include "Simple-Graph/breadth_first_search.hpp"
+#include "Simple-Graph/depth_first_search.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+#include "Simple-Graph/fixed_capacity.hpp"
+
+#include "helper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <version>
+
+using namespace sl::graph;
+
+namespace
+{
+	constexpr int vertexCount{ 6 };
+
+	/*
+	 * 0 --1-- 1 --1-- 2
+	 * |       |       |
+	 * 5       1       7
+	 * |       |       |
+	 * 3 --1-- 4 --1-- 5
+	 */
+	constexpr std::array<std::array<std::pair<int, int>, 3>, vertexCount> edges
+	{
+		{
+			{ { { 1, 1 }, { 3, 5 }, { -1, 0 } } },
+			{ { { 0, 1 }, { 2, 1 }, { 4, 1 } } },
+			{ { { 1, 1 }, { 5, 7 }, { -1, 0 } } },
+			{ { { 0, 5 }, { 4, 1 }, { -1, 0 } } },
+			{ { { 1, 1 }, { 3, 1 }, { 5, 1 } } },
+			{ { { 2, 7 }, { 4, 1 }, { -1, 0 } } }
+		}
+	};
+
+	struct static_neighbor_searcher
+	{
+		constexpr auto operator ()(const int& v) const
+		{
+			return edges[v]
+				| std::views::take_while([](const auto& edge) { return 0 <= edge.first; })
+				| std::views::keys;
+		}
+	};
+
+	struct static_weight_extractor
+	{
+		constexpr int operator ()(const int& predecessor, const int& current) const
+		{
+			return std::ranges::find(edges[predecessor], current, &std::pair<int, int>::first)->second;
+		}
+	};
+
+	template <class TNode>
+	using fixed_open_list_t = fixed_priority_queue<TNode, 2 * 3 * vertexCount, std::greater<>>;
+
+	constexpr std::array<int, vertexCount> dijkstra_distances(int begin)
+	{
+		std::array<int, vertexCount> distances{};
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = static_neighbor_searcher{},
+				.weightCalculator = static_weight_extractor{},
+				.callback = [&](const auto& node) { distances[node.vertex] = node.weight_sum; },
+				.stateMap = fixed_state_map<dijkstra::state_t<int>, vertexCount>{},
+				.openList = fixed_open_list_t<dijkstra::node_t<int, int>>{}
+			}
+		);
+		return distances;
+	}
+}
+
+TEST_CASE("fixed capacity containers should behave like their standard counterparts.", "[fixed_capacity]")
+{
+	constexpr auto check = []
+	{
+		fixed_queue<int, 3> queue{};
+		fixed_stack<int, 3> stack{};
+		fixed_priority_queue<int, 4> priorityQueue{};
+
+		// wraps around the end of the ring buffer
+		emplace(queue, 1);
+		emplace(queue, 2);
+		const bool queueOk{ take_next(queue) == 1 };
+		emplace(queue, 3);
+		emplace(queue, 4);
+		const bool queueOk2{ take_next(queue) == 2 && take_next(queue) == 3 && take_next(queue) == 4 && std::empty(queue) };
+
+		emplace(stack, 1);
+		emplace(stack, 2);
+		const bool stackOk{ take_next(stack) == 2 && take_next(stack) == 1 && std::empty(stack) };
+
+		for (const int value : { 3, 1, 4, 2 })
+		{
+			emplace(priorityQueue, value);
+		}
+		const bool priorityQueueOk{ take_next(priorityQueue) == 4 && take_next(priorityQueue) == 3 && std::size(priorityQueue) == 2 };
+		priorityQueue.clear();
+
+		return queueOk && queueOk2 && stackOk && priorityQueueOk && std::empty(priorityQueue);
+	};
+
+	STATIC_REQUIRE(check());
+	REQUIRE(check());
+}
+
+// evaluating the search_params at compile time requires a constexpr std::optional destructor
+#if __cpp_lib_optional >= 202106L
+
+TEST_CASE("dijkstra traverse should be usable in constant expressions.", "[fixed_capacity][dijkstra]")
+{
+	constexpr auto distanceTable = []
+	{
+		std::array<std::array<int, vertexCount>, vertexCount> table{};
+		for (int begin{ 0 }; begin < vertexCount; ++begin)
+		{
+			table[begin] = dijkstra_distances(begin);
+		}
+		return table;
+	}();
+
+	STATIC_REQUIRE(distanceTable[0] == std::array{ 0, 1, 2, 3, 2, 3 });
+	STATIC_REQUIRE(distanceTable[5] == std::array{ 3, 2, 3, 2, 1, 0 });
+
+	for (int begin{ 0 }; begin < vertexCount; ++begin)
+	{
+		REQUIRE(distanceTable[begin] == dijkstra_distances(begin));
+	}
+}
+
+TEST_CASE("bfs and dfs traverse should be usable in constant expressions.", "[fixed_capacity][bfs][dfs]")
+{
+	constexpr auto bfsDepths = []
+	{
+		std::array<int, vertexCount> depths{};
+		traverse
+		(
+			bfs::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = static_neighbor_searcher{},
+				.callback = [&](const auto& node) { depths[node.vertex] = node.weight_sum; },
+				.stateMap = fixed_state_map<bool, vertexCount>{},
+				.openList = fixed_queue<bfs::node_t<int>, vertexCount>{}
+			}
+		);
+		return depths;
+	}();
+
+	constexpr int dfsVisits = []
+	{
+		int visits{ 0 };
+		traverse
+		(
+			dfs::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = static_neighbor_searcher{},
+				.callback = [&](const auto&) { ++visits; },
+				.stateMap = fixed_state_map<bool, vertexCount>{},
+				.openList = fixed_stack<dfs::node_t<int>, vertexCount>{}
+			}
+		);
+		return visits;
+	}();
+
+	STATIC_REQUIRE(bfsDepths == std::array{ 0, 1, 2, 1, 2, 3 });
+	STATIC_REQUIRE(dfsVisits == vertexCount);
+}
+
+// find_path additionally builds and returns a std::vector
+#if __cpp_lib_constexpr_vector
+
+TEST_CASE("astar find_path should be usable in constant expressions.", "[fixed_capacity][astar][find_path]")
+{
+	constexpr auto path = []
+	{
+		const std::optional found = find_path
+		(
+			astar::search_params
+			{
+				.begin = 2,
+				.neighborSearcher = static_neighbor_searcher{},
+				.weightCalculator = static_weight_extractor{},
+				.heuristic = constant_t<0>{},
+				.callback = vertex_destination_t{ 3 },
+				.stateMap = fixed_state_map<astar::state_t<int>, vertexCount>{},
+				.openList = fixed_open_list_t<astar::node_t<int, int>>{}
+			},
+			fixed_state_map<std::optional<int>, vertexCount>{}
+		);
+
+		// vectors must not leave the constant evaluation
+		std::array<int, vertexCount> result{};
+		std::ranges::fill(result, -1);
+		std::ranges::copy(*found, std::begin(result));
+		return result;
+	}();
+
+	STATIC_REQUIRE(path == std::array{ 3, 4, 1, 2, -1, -1 });
+}
+
+#endif
+
+#endif
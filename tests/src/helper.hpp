@@ -8,11 +8,19 @@
 
 #pragma once
 
+#include "adjacency_graph.hpp"
+
+#include "Simple-Graph/dijkstra.hpp"
 #include "Simple-Vector/Vector.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <map>
+#include <optional>
+#include <random>
 #include <ranges>
+#include <utility>
 #include <vector>
 
 template <class T, int VWidth, int VHeight>
@@ -111,4 +119,97 @@ struct linear_graph_neighbor_searcher
 	}
 };
 
+// row-major grid, where a cost of 0 denotes a blocked cell
+struct cost_grid
+{
+	int width{};
+	int height{};
+	std::vector<int> costs{};
+};
+
+inline cost_grid make_random_grid(int width, int height, unsigned seed)
+{
+	std::mt19937 gen{ seed };
+	std::uniform_int_distribution<int> costDist{ 1, 5 };
+	std::bernoulli_distribution blockedDist{ 0.2 };
+
+	cost_grid grid{ width, height, std::vector<int>(static_cast<std::size_t>(width * height)) };
+	for (int& cost : grid.costs)
+	{
+		cost = blockedDist(gen) ? 0 : costDist(gen);
+	}
+	return grid;
+}
+
+struct cost_grid_neighbor_searcher
+{
+	const cost_grid* grid{};
+
+	std::vector<int> operator ()(int v) const
+	{
+		const int x{ v % grid->width };
+		const int y{ v / grid->width };
+		std::vector<int> neighbors{};
+		if (grid->costs[v] == 0)
+			return neighbors;
+
+		for (const auto& [dx, dy] : { std::pair{ -1, 0 }, std::pair{ 1, 0 }, std::pair{ 0, -1 }, std::pair{ 0, 1 } })
+		{
+			const int curX{ x + dx };
+			const int curY{ y + dy };
+			if (0 <= curX && curX < grid->width && 0 <= curY && curY < grid->height && grid->costs[curY * grid->width + curX] != 0)
+			{
+				neighbors.emplace_back(curY * grid->width + curX);
+			}
+		}
+		return neighbors;
+	}
+};
+
+struct cost_grid_weight_extractor
+{
+	const cost_grid* grid{};
+
+	int operator ()(int, int cur) const
+	{
+		return grid->costs[cur];
+	}
+};
+
+// reference distances of a complete dijkstra traversal over dense vertex ids; unreachable vertices are set to std::nullopt
+template <class TNeighborSearcher, class TWeightCalculator, class TOpenList = sl::graph::dijkstra::default_open_list_t<int, int>>
+std::vector<std::optional<int>> dijkstra_distances
+(
+	std::size_t vertexCount,
+	int begin,
+	TNeighborSearcher neighborSearcher,
+	TWeightCalculator weightCalculator,
+	TOpenList openList = {}
+)
+{
+	std::vector<std::optional<int>> distances(vertexCount);
+	sl::graph::traverse
+	(
+		sl::graph::dijkstra::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = std::move(neighborSearcher),
+			.weightCalculator = std::move(weightCalculator),
+			.callback = [&](const auto& node) { distances[node.vertex] = node.weight_sum; },
+			.openList = std::move(openList)
+		}
+	);
+	return distances;
+}
+
+inline std::vector<std::optional<int>> dijkstra_distances(const adjacency_graph& graph, int begin)
+{
+	return dijkstra_distances(std::size(graph.edges), begin, adjacency_graph_neighbor_searcher{ &graph }, adjacency_graph_weight_extractor{ &graph });
+}
+
+inline std::vector<std::optional<int>> dijkstra_distances(const cost_grid& grid, int begin)
+{
+	return dijkstra_distances(std::size(grid.costs), begin, cost_grid_neighbor_searcher{ &grid }, cost_grid_weight_extractor{ &grid });
+}
+
 #endif
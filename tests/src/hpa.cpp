@@ -0,0 +1,172 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/dijkstra.hpp"
+#include "Simple-Graph/hpa.hpp"
+
+#include "helper.hpp"
+
+#include <random>
+
+using namespace sl::graph;
+
+namespace
+{
+	auto make_abstract_graph(const cost_grid& grid, int clusterSize, std::size_t threadCount)
+	{
+		return build_abstract_graph
+		(
+			hpa::build_params
+			{
+				.width = grid.width,
+				.height = grid.height,
+				.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+				.weightCalculator = cost_grid_weight_extractor{ &grid },
+				.clusterSize = clusterSize,
+				.threadCount = threadCount
+			}
+		);
+	}
+
+	// validates the reversed path and returns its cost
+	int path_cost(const cost_grid& grid, const std::vector<int>& path, int begin, int destination)
+	{
+		REQUIRE(!std::empty(path));
+		REQUIRE(path.front() == destination);
+		REQUIRE(path.back() == begin);
+
+		int cost{ 0 };
+		for (std::size_t i{ 1 }; i < std::size(path); ++i)
+		{
+			const std::vector<int> neighbors{ cost_grid_neighbor_searcher{ &grid }(path[i]) };
+			REQUIRE(std::ranges::find(neighbors, path[i - 1]) != std::end(neighbors));
+			cost += grid.costs[path[i - 1]];
+		}
+		return cost;
+	}
+}
+
+TEST_CASE("hpa::graph_t should assign cells to their clusters.", "[hpa]")
+{
+	const cost_grid grid{ make_random_grid(20, 10, 42) };
+	const auto graph = make_abstract_graph(grid, 8, 1);
+
+	REQUIRE(graph.cluster_count() == 6);
+	REQUIRE(graph.cluster_of(0) == 0);
+	REQUIRE(graph.cluster_of(7) == 0);
+	REQUIRE(graph.cluster_of(8) == 1);
+	REQUIRE(graph.cluster_of(19) == 2);
+	REQUIRE(graph.cluster_of(8 * 20) == 3);
+	REQUIRE(graph.cluster_of(9 * 20 + 19) == 5);
+}
+
+TEST_CASE("hpa::graph_t should create entrances on cluster borders only.", "[hpa]")
+{
+	const cost_grid grid{ make_random_grid(64, 64, 1337) };
+	const auto graph = make_abstract_graph(grid, 8, 1);
+
+	for (std::size_t cluster{ 0 }; cluster < graph.cluster_count(); ++cluster)
+	{
+		for (const int entrance : graph.entrances(cluster))
+		{
+			REQUIRE(graph.cluster_of(entrance) == cluster);
+			const int x{ entrance % 64 };
+			const int y{ entrance / 64 };
+			REQUIRE((x % 8 == 0 || x % 8 == 7 || y % 8 == 0 || y % 8 == 7));
+		}
+	}
+}
+
+TEST_CASE("find_path should find valid near-optimal paths on hpa::graph_t.", "[hpa]")
+{
+	const std::size_t threadCount = GENERATE(1u, 4u);
+	const int clusterSize = GENERATE(4, 10, 16);
+
+	const cost_grid grid{ make_random_grid(64, 48, 1337) };
+	const auto graph = make_abstract_graph(grid, clusterSize, threadCount);
+
+	std::mt19937 gen{ 42 };
+	std::uniform_int_distribution<int> vertexDist{ 0, static_cast<int>(std::size(grid.costs)) - 1 };
+	for (int i{ 0 }; i < 20; ++i)
+	{
+		const int begin{ vertexDist(gen) };
+		const std::vector distances{ dijkstra_distances(grid, begin) };
+		for (int j{ 0 }; j < 10; ++j)
+		{
+			const int destination{ vertexDist(gen) };
+			const std::optional path = find_path(graph, begin, destination);
+
+			REQUIRE(path.has_value() == distances[destination].has_value());
+			if (path)
+			{
+				const int cost{ path_cost(grid, *path, begin, destination) };
+				REQUIRE(*distances[destination] <= cost);
+				REQUIRE(cost <= *distances[destination] * 2 + 20);
+			}
+		}
+	}
+}
+
+TEST_CASE("find_path should accept a heuristic on hpa::graph_t.", "[hpa]")
+{
+	const cost_grid grid{ make_random_grid(64, 64, 42) };
+	const auto graph = make_abstract_graph(grid, 8, 1);
+
+	const int begin{ 65 };
+	const int destination{ 64 * 62 + 62 };
+	const std::vector distances{ dijkstra_distances(grid, begin) };
+	const std::optional path = find_path
+	(
+		graph,
+		begin,
+		destination,
+		[&](int v) { return std::abs(v % 64 - destination % 64) + std::abs(v / 64 - destination / 64); }
+	);
+
+	REQUIRE(path.has_value() == distances[destination].has_value());
+	if (path)
+	{
+		REQUIRE(*distances[destination] <= path_cost(grid, *path, begin, destination));
+	}
+}
+
+TEST_CASE("hpa::graph_t::rebuild_cluster should apply changed costs.", "[hpa]")
+{
+	cost_grid grid{ make_random_grid(48, 48, 7) };
+	auto graph = make_abstract_graph(grid, 8, 1);
+
+	// walls off the center cluster, thus it becomes unreachable
+	const std::size_t cluster{ graph.cluster_of(20 * 48 + 20) };
+	for (int i{ 16 }; i < 24; ++i)
+	{
+		grid.costs[16 * 48 + i] = 0;
+		grid.costs[23 * 48 + i] = 0;
+		grid.costs[i * 48 + 16] = 0;
+		grid.costs[i * 48 + 23] = 0;
+	}
+	grid.costs[20 * 48 + 20] = 1;
+	grid.costs[0] = 1;
+	graph.rebuild_cluster(cluster);
+
+	REQUIRE(std::empty(graph.entrances(cluster)));
+	REQUIRE(!find_path(graph, 0, 20 * 48 + 20));
+
+	// all other queries must still match a freshly built graph
+	const auto freshGraph = make_abstract_graph(grid, 8, 1);
+	for (std::size_t i{ 0 }; i < graph.cluster_count(); ++i)
+	{
+		REQUIRE(std::ranges::equal(graph.entrances(i), freshGraph.entrances(i)));
+	}
+
+	for (const int destination : { 47, 47 * 48, 47 * 48 + 47, 10 * 48 + 30 })
+	{
+		const std::vector distances{ dijkstra_distances(grid, 0) };
+		REQUIRE(find_path(graph, 0, destination) == find_path(freshGraph, 0, destination));
+		REQUIRE(find_path(graph, 0, destination).has_value() == distances[destination].has_value());
+	}
+}
@@ -0,0 +1,127 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/dijkstra.hpp"
+#include "Simple-Graph/hub_labels.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+namespace
+{
+	hub_labels::labels_t<int, int> make_labels(const adjacency_graph& graph, std::vector<int> order, std::size_t threadCount)
+	{
+		return build_hub_labels
+		(
+			hub_labels::build_params
+			{
+				.graph = make_csr_graph<int>
+				(
+					std::size(graph.edges),
+					adjacency_graph_neighbor_searcher{ &graph },
+					adjacency_graph_weight_extractor{ &graph }
+				),
+				.order = std::move(order),
+				.threadCount = threadCount
+			}
+		);
+	}
+}
+
+TEST_CASE("hub_label_intersect should yield the least distance sum over all shared hubs.", "[hub_labels]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+	std::mt19937 gen{ seed };
+
+	const auto make_label = [&](int size)
+	{
+		std::vector<int> hubs(64);
+		std::iota(std::begin(hubs), std::end(hubs), 0);
+		std::ranges::shuffle(hubs, gen);
+		hubs.resize(size);
+		std::ranges::sort(hubs);
+
+		std::vector<int> distances(size);
+		std::ranges::generate(distances, [&] { return std::uniform_int_distribution{ 0, 100 }(gen); });
+		return std::tuple{ hubs, distances };
+	};
+
+	for (int lhsSize{ 0 }; lhsSize < 40; lhsSize += 3)
+	{
+		for (int rhsSize{ 0 }; rhsSize < 40; rhsSize += 5)
+		{
+			const auto [lhsHubs, lhsDistances] = make_label(lhsSize);
+			const auto [rhsHubs, rhsDistances] = make_label(rhsSize);
+
+			int expected{ std::numeric_limits<int>::max() };
+			for (int i{ 0 }; i < lhsSize; ++i)
+			{
+				for (int j{ 0 }; j < rhsSize; ++j)
+				{
+					if (lhsHubs[i] == rhsHubs[j])
+						expected = std::min(expected, lhsDistances[i] + rhsDistances[j]);
+				}
+			}
+
+			REQUIRE(detail::hub_label_intersect<int, int>(lhsHubs, lhsDistances, rhsHubs, rhsDistances) == expected);
+			REQUIRE(detail::hub_label_intersect<int, int>(rhsHubs, rhsDistances, lhsHubs, lhsDistances) == expected);
+		}
+	}
+}
+
+TEST_CASE("hub labels should yield the exact distances between all vertices.", "[hub_labels]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+	const std::size_t threadCount = GENERATE(1u, 3u);
+	const adjacency_graph graph{ make_random_graph(60, 3, 9, seed) };
+
+	const hub_labels::labels_t labels = make_labels(graph, {}, threadCount);
+
+	REQUIRE(labels.vertex_count() == 60);
+	for (int begin{ 0 }; begin < 60; ++begin)
+	{
+		const std::vector distances = dijkstra_distances(graph, begin);
+		for (int destination{ 0 }; destination < 60; ++destination)
+		{
+			REQUIRE(labels.distance(begin, destination) == distances[destination]);
+		}
+	}
+}
+
+TEST_CASE("hub labels should be sorted by hub rank.", "[hub_labels]")
+{
+	const adjacency_graph graph{ make_random_graph(60, 3, 9, 42) };
+
+	const hub_labels::labels_t labels = make_labels(graph, {}, 2);
+
+	for (int v{ 0 }; v < 60; ++v)
+	{
+		REQUIRE(std::ranges::adjacent_find(labels.out_hubs(v), std::ranges::greater_equal{}) == std::end(labels.out_hubs(v)));
+		REQUIRE(std::ranges::adjacent_find(labels.in_hubs(v), std::ranges::greater_equal{}) == std::end(labels.in_hubs(v)));
+		REQUIRE(std::size(labels.out_hubs(v)) == std::size(labels.out_distances(v)));
+		REQUIRE(std::size(labels.in_hubs(v)) == std::size(labels.in_distances(v)));
+	}
+}
+
+TEST_CASE("hub labels should respect the provided order.", "[hub_labels]")
+{
+	// 0 -> 1 -> 2 -> 3
+	const adjacency_graph graph{ { { { 1, 1 } }, { { 2, 1 } }, { { 3, 1 } }, {} } };
+
+	const hub_labels::labels_t labels = make_labels(graph, { 1, 2, 0, 3 }, 1);
+
+	REQUIRE(labels.hub(0) == 1);
+	REQUIRE(labels.hub(2) == 0);
+	REQUIRE(labels.distance(0, 3) == 3);
+	REQUIRE(labels.distance(3, 0) == std::nullopt);
+
+	// vertex 1 covers each path passing it, thus it's the only hub required for the query from 0 to 3
+	REQUIRE(std::ranges::equal(labels.in_hubs(3), std::vector{ 0, 1, 3 }));
+	REQUIRE(std::ranges::equal(labels.out_hubs(0), std::vector{ 0, 2 }));
+}
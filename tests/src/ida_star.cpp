@@ -0,0 +1,272 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/astar.hpp"
+#include "Simple-Graph/dijkstra.hpp"
+#include "Simple-Graph/ida_star.hpp"
+
+#include "helper.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+
+using namespace sl::graph;
+
+namespace
+{
+	// the 8-puzzle; each tile occupies 4 bits, where 0 denotes the blank
+	using puzzle_t = std::uint64_t;
+
+	constexpr puzzle_t solved_puzzle{ 0x087654321 };
+
+	constexpr int tile_at(puzzle_t puzzle, int index)
+	{
+		return static_cast<int>(puzzle >> (index * 4) & 0xF);
+	}
+
+	constexpr puzzle_t swap_tiles(puzzle_t puzzle, int lhs, int rhs)
+	{
+		const auto lhsTile{ static_cast<puzzle_t>(tile_at(puzzle, lhs)) };
+		const auto rhsTile{ static_cast<puzzle_t>(tile_at(puzzle, rhs)) };
+		puzzle &= ~(puzzle_t{ 0xF } << (lhs * 4) | puzzle_t{ 0xF } << (rhs * 4));
+		return puzzle | lhsTile << (rhs * 4) | rhsTile << (lhs * 4);
+	}
+
+	struct puzzle_neighbor_searcher
+	{
+		std::vector<puzzle_t> operator ()(puzzle_t puzzle) const
+		{
+			int blank{ 0 };
+			while (tile_at(puzzle, blank) != 0)
+				++blank;
+
+			std::vector<puzzle_t> neighbors{};
+			const int x{ blank % 3 };
+			const int y{ blank / 3 };
+			if (0 < x)
+				neighbors.emplace_back(swap_tiles(puzzle, blank, blank - 1));
+			if (x < 2)
+				neighbors.emplace_back(swap_tiles(puzzle, blank, blank + 1));
+			if (0 < y)
+				neighbors.emplace_back(swap_tiles(puzzle, blank, blank - 3));
+			if (y < 2)
+				neighbors.emplace_back(swap_tiles(puzzle, blank, blank + 3));
+			return neighbors;
+		}
+	};
+
+	struct puzzle_manhattan_heuristic
+	{
+		int operator ()(puzzle_t puzzle) const
+		{
+			int distance{ 0 };
+			for (int i{ 0 }; i < 9; ++i)
+			{
+				if (const int tile{ tile_at(puzzle, i) }; tile != 0)
+				{
+					distance += std::abs(i % 3 - (tile - 1) % 3) + std::abs(i / 3 - (tile - 1) / 3);
+				}
+			}
+			return distance;
+		}
+	};
+
+	puzzle_t scramble_puzzle(int moves, unsigned seed)
+	{
+		std::mt19937 gen{ seed };
+		puzzle_t puzzle{ solved_puzzle };
+		for (int i{ 0 }; i < moves; ++i)
+		{
+			const std::vector neighbors{ puzzle_neighbor_searcher{}(puzzle) };
+			puzzle = neighbors[std::uniform_int_distribution<std::size_t>{ 0, std::size(neighbors) - 1 }(gen)];
+		}
+		return puzzle;
+	}
+
+	std::optional<std::size_t> astar_path_length(puzzle_t begin)
+	{
+		const std::optional path = find_path
+		(
+			astar::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = puzzle_neighbor_searcher{},
+				.weightCalculator = constant_t<1>{},
+				.heuristic = puzzle_manhattan_heuristic{},
+				.callback = [](const auto& node) { return node.vertex == solved_puzzle; }
+			},
+			std::map<puzzle_t, std::optional<puzzle_t>>{}
+		);
+		return path ? std::optional{ std::size(*path) } : std::nullopt;
+	}
+
+	std::optional<int> dijkstra_distance(const cost_grid& grid, int begin, int destination)
+	{
+		std::optional<int> distance{};
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+				.weightCalculator = cost_grid_weight_extractor{ &grid },
+				.callback = [&](const auto& node)
+				{
+					if (node.vertex == destination)
+					{
+						distance = node.weight_sum;
+						return true;
+					}
+					return false;
+				}
+			}
+		);
+		return distance;
+	}
+}
+
+TEST_CASE("transposition_table_t should prune vertices reached with equal or higher cost.", "[ida_star]")
+{
+	ida_star::transposition_table_t<int, int> table{ 16 };
+
+	REQUIRE(table.capacity() == 16);
+	REQUIRE(!table.prune(1, 3, 5));
+	REQUIRE(table.prune(1, 3, 5));
+	REQUIRE(table.prune(1, 3, 6));
+	REQUIRE(!table.prune(1, 3, 4));
+	REQUIRE(!table.prune(2, 3, 4));
+
+	// colliding vertices replace each other
+	REQUIRE(!table.prune(2, 19, 1));
+	REQUIRE(!table.prune(2, 3, 4));
+}
+
+TEST_CASE("ida_star find_path should find the trivial path.", "[ida_star][find_path]")
+{
+	const std::optional path = find_path
+	(
+		ida_star::search_params
+		{
+			.begin = solved_puzzle,
+			.neighborSearcher = puzzle_neighbor_searcher{},
+			.weightCalculator = constant_t<1>{},
+			.heuristic = puzzle_manhattan_heuristic{},
+			.callback = [](const auto& node) { return node.vertex == solved_puzzle; }
+		}
+	);
+
+	REQUIRE(path == std::vector{ solved_puzzle });
+}
+
+TEST_CASE("ida_star find_path should solve the 8-puzzle optimally.", "[ida_star][find_path]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+	const puzzle_t begin{ scramble_puzzle(40, seed) };
+	const std::optional expectedLength = astar_path_length(begin);
+	REQUIRE(expectedLength);
+
+	SECTION("without transposition table")
+	{
+		const std::optional path = find_path
+		(
+			ida_star::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = puzzle_neighbor_searcher{},
+				.weightCalculator = constant_t<1>{},
+				.heuristic = puzzle_manhattan_heuristic{},
+				.callback = [](const auto& node) { return node.vertex == solved_puzzle; }
+			}
+		);
+
+		REQUIRE(path);
+		REQUIRE(std::size(*path) == *expectedLength);
+		REQUIRE(path->front() == solved_puzzle);
+		REQUIRE(path->back() == begin);
+		for (std::size_t i{ 1 }; i < std::size(*path); ++i)
+		{
+			REQUIRE(std::ranges::count(puzzle_neighbor_searcher{}((*path)[i]), (*path)[i - 1]) == 1);
+		}
+	}
+
+	SECTION("with transposition table")
+	{
+		const std::optional path = find_path
+		(
+			ida_star::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = puzzle_neighbor_searcher{},
+				.weightCalculator = constant_t<1>{},
+				.heuristic = puzzle_manhattan_heuristic{},
+				.callback = [](const auto& node) { return node.vertex == solved_puzzle; },
+				.transpositionTable = ida_star::transposition_table_t<puzzle_t, int>{ 1024 }
+			}
+		);
+
+		REQUIRE(path);
+		REQUIRE(std::size(*path) == *expectedLength);
+	}
+}
+
+TEST_CASE("ida_star find_path should yield optimal paths on weighted grids.", "[ida_star][find_path]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+
+	cost_grid grid{ make_random_grid(8, 8, seed) };
+	const int begin{ 0 };
+	const int destination{ 8 * 8 - 1 };
+	grid.costs[begin] = 1;
+	grid.costs[destination] = 1;
+
+	const std::optional path = find_path
+	(
+		ida_star::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.heuristic = [](int v) { return 7 - v % 8 + 7 - v / 8; },
+			.callback = [&](const auto& node) { return node.vertex == destination; },
+			.transpositionTable = ida_star::transposition_table_t<int, int>{ 32 }
+		}
+	);
+
+	const std::optional expected = dijkstra_distance(grid, begin, destination);
+	REQUIRE(path.has_value() == expected.has_value());
+	if (path)
+	{
+		int cost{ 0 };
+		for (std::size_t i{ 0 }; i + 1 < std::size(*path); ++i)
+		{
+			cost += grid.costs[(*path)[i]];
+		}
+		REQUIRE(cost == *expected);
+	}
+}
+
+TEST_CASE("ida_star traverse should invoke the callback for each expansion.", "[ida_star]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 5 };
+	std::unordered_map<int, int> expansions{};
+	traverse
+	(
+		ida_star::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.heuristic = constant_t<0>{},
+			.callback = [&](const auto& node) { ++expansions[node.vertex]; }
+		}
+	);
+
+	// each iteration expands one more vertex
+	REQUIRE(expansions == std::unordered_map<int, int>{ { 0, 5 }, { 1, 4 }, { 2, 3 }, { 3, 2 }, { 4, 1 } });
+}
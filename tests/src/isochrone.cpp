@@ -0,0 +1,171 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/dijkstra.hpp"
+#include "Simple-Graph/isochrone.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+TEST_CASE("reachable_vertices should only yield the begin, if the budget is zero.", "[isochrone]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 10 };
+
+	const auto reached = reachable_vertices
+	(
+		isochrone::search_params
+		{
+			.begin = 3,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.budget = 0
+		}
+	);
+
+	REQUIRE(reached == std::vector{ isochrone::reached_t{ 3, 0 } });
+}
+
+TEST_CASE("reachable_vertices should yield nothing, if the lower bound of the begin exceeds the budget.", "[isochrone]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 10 };
+
+	const auto reached = reachable_vertices
+	(
+		isochrone::search_params
+		{
+			.begin = 3,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.budget = 4,
+			.lowerBound = constant_t<5>{}
+		}
+	);
+
+	REQUIRE(std::empty(reached));
+}
+
+TEST_CASE("reachable_vertices should yield exactly the vertices within the budget.", "[isochrone]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+	const int budget = GENERATE(0, 7, 20, 1000);
+
+	const cost_grid grid{ make_random_grid(32, 32, seed) };
+	const int begin{ static_cast<int>(std::ranges::find_if(grid.costs, [](int cost) { return cost != 0; }) - std::begin(grid.costs)) };
+	const auto distances = dijkstra_distances(grid, begin);
+
+	int expansions{ 0 };
+	const auto reached = reachable_vertices
+	(
+		isochrone::search_params
+		{
+			.begin = begin,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.budget = budget,
+			.callback = [&](const auto&) { ++expansions; }
+		}
+	);
+
+	REQUIRE(expansions == std::ssize(reached));
+	REQUIRE(std::ranges::is_sorted(reached, {}, [](const auto& r) { return r.weight_sum; }));
+
+	std::vector<std::optional<int>> reachedDistances(std::size(grid.costs));
+	for (const auto& [vertex, weightSum] : reached)
+	{
+		REQUIRE(!reachedDistances[vertex]);
+		reachedDistances[vertex] = weightSum;
+	}
+
+	for (std::size_t i{ 0 }; i < std::size(distances); ++i)
+	{
+		if (distances[i] && *distances[i] <= budget)
+		{
+			REQUIRE(reachedDistances[i] == distances[i]);
+		}
+		else
+		{
+			REQUIRE(!reachedDistances[i]);
+		}
+	}
+}
+
+TEST_CASE("reachable_vertices should additionally prune vertices by the lower bound.", "[isochrone]")
+{
+	const cost_grid grid{ 16, 16, std::vector<int>(16 * 16, 1) };
+	constexpr int budget{ 10 };
+
+	// reachable round trips from the corner
+	const auto manhattan = [](int v) { return v % 16 + v / 16; };
+	const auto reached = reachable_vertices
+	(
+		isochrone::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.budget = budget,
+			.lowerBound = manhattan
+		}
+	);
+
+	REQUIRE(std::size(reached) == 21);
+	for (const auto& [vertex, weightSum] : reached)
+	{
+		REQUIRE(weightSum == manhattan(vertex));
+		REQUIRE(weightSum * 2 <= budget);
+	}
+}
+
+TEST_CASE("isochrone traverse should respect the vertex predicate.", "[isochrone]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 10 };
+
+	std::vector<int> vertices{};
+	traverse
+	(
+		isochrone::search_params
+		{
+			.begin = 5,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.budget = 3,
+			.callback = [&](const auto& node) { vertices.emplace_back(node.vertex); },
+			.vertexPredicate = [](const auto&, int v) { return v <= 5; }
+		}
+	);
+
+	REQUIRE(vertices == std::vector{ 5, 4, 3, 2 });
+}
+
+TEST_CASE("isochrone find_paths should only return paths within the budget.", "[isochrone][find_path]")
+{
+	const cost_grid grid{ 16, 16, std::vector<int>(16 * 16, 1) };
+
+	const auto paths = find_paths
+	(
+		isochrone::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+			.weightCalculator = cost_grid_weight_extractor{ &grid },
+			.budget = 5
+		},
+		std::vector{ 5, 16 + 4, 16 * 3 + 3, 6 }
+	);
+
+	REQUIRE(std::size(paths) == 4);
+	REQUIRE(paths[0] == std::vector{ 5, 4, 3, 2, 1, 0 });
+	REQUIRE(paths[1]);
+	REQUIRE(std::size(*paths[1]) == 6);
+	REQUIRE(!paths[2]);
+	REQUIRE(!paths[3]);
+}
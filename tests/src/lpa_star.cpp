@@ -0,0 +1,186 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/dijkstra.hpp"
+#include "Simple-Graph/lpa_star.hpp"
+
+#include "helper.hpp"
+
+#include <unordered_map>
+
+using namespace sl::graph;
+
+namespace
+{
+	std::optional<int> dijkstra_distance(const cost_grid& grid, int begin, int destination)
+	{
+		std::optional<int> distance{};
+		traverse
+		(
+			dijkstra::search_params
+			{
+				.begin = begin,
+				.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+				.weightCalculator = cost_grid_weight_extractor{ &grid },
+				.callback = [&](const auto& node)
+				{
+					if (node.vertex == destination)
+					{
+						distance = node.weight_sum;
+						return true;
+					}
+					return false;
+				}
+			}
+		);
+		return distance;
+	}
+
+	struct manhattan_heuristic
+	{
+		const cost_grid* grid{};
+		int destination{};
+
+		int operator ()(int v) const
+		{
+			return std::abs(v % grid->width - destination % grid->width) + std::abs(v / grid->width - destination / grid->width);
+		}
+	};
+
+	auto make_planner(const cost_grid& grid, int begin, int destination)
+	{
+		return lpa_star::planner_t
+		{
+			lpa_star::search_params
+			{
+				.begin = begin,
+				.destination = destination,
+				.neighborSearcher = cost_grid_neighbor_searcher{ &grid },
+				.predecessorSearcher = cost_grid_neighbor_searcher{ &grid },
+				.weightCalculator = cost_grid_weight_extractor{ &grid },
+				.heuristic = manhattan_heuristic{ &grid, destination },
+				.stateMap = std::unordered_map<int, lpa_star::state_t<int>>{}
+			}
+		};
+	}
+
+	// validates the reversed path and returns its cost
+	int path_cost(const cost_grid& grid, const std::vector<int>& path, int begin, int destination)
+	{
+		REQUIRE(!std::empty(path));
+		REQUIRE(path.front() == destination);
+		REQUIRE(path.back() == begin);
+
+		int cost{ 0 };
+		for (std::size_t i{ 1 }; i < std::size(path); ++i)
+		{
+			const std::vector<int> neighbors{ cost_grid_neighbor_searcher{ &grid }(path[i]) };
+			REQUIRE(std::ranges::find(neighbors, path[i - 1]) != std::end(neighbors));
+			cost += grid.costs[path[i - 1]];
+		}
+		return cost;
+	}
+}
+
+TEST_CASE("lpa_star planner should find the trivial path.", "[lpa_star]")
+{
+	cost_grid grid{ make_random_grid(8, 8, 42) };
+	grid.costs[9] = 1;
+	auto planner = make_planner(grid, 9, 9);
+
+	REQUIRE(planner.compute_distance() == 0);
+	REQUIRE(planner.find_path() == std::vector{ 9 });
+}
+
+TEST_CASE("lpa_star planner should yield the same distances as dijkstra.", "[lpa_star]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+
+	cost_grid grid{ make_random_grid(32, 32, seed) };
+	grid.costs[0] = 1;
+	grid.costs[32 * 32 - 1] = 1;
+	auto planner = make_planner(grid, 0, 32 * 32 - 1);
+
+	const std::optional expected = dijkstra_distance(grid, 0, 32 * 32 - 1);
+	REQUIRE(planner.compute_distance() == expected);
+
+	const std::optional path = planner.find_path();
+	REQUIRE(path.has_value() == expected.has_value());
+	if (path)
+	{
+		REQUIRE(path_cost(grid, *path, 0, 32 * 32 - 1) == *expected);
+	}
+}
+
+TEST_CASE("lpa_star planner should repair its search after changes.", "[lpa_star]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u);
+
+	cost_grid grid{ make_random_grid(40, 40, seed) };
+	const int begin{ 41 };
+	const int destination{ 40 * 38 + 38 };
+	grid.costs[begin] = 1;
+	grid.costs[destination] = 1;
+	auto planner = make_planner(grid, begin, destination);
+	REQUIRE(planner.compute_distance() == dijkstra_distance(grid, begin, destination));
+
+	std::mt19937 gen{ seed };
+	std::uniform_int_distribution<int> vertexDist{ 0, 40 * 40 - 1 };
+	std::uniform_int_distribution<int> costDist{ 0, 5 };
+	for (int i{ 0 }; i < 30; ++i)
+	{
+		std::vector<int> changedCells{};
+		for (int j{ 0 }; j < 5; ++j)
+		{
+			const int cell{ vertexDist(gen) };
+			if (cell != begin && cell != destination)
+			{
+				grid.costs[cell] = costDist(gen);
+				changedCells.emplace_back(cell);
+			}
+		}
+
+		// a blocked or unblocked cell changes the edges of its neighbors, too
+		std::vector<std::pair<int, int>> changedEdges{};
+		for (const int cell : changedCells)
+		{
+			for (const int neighbor : { cell - 1, cell + 1, cell - 40, cell + 40 })
+			{
+				if (0 <= neighbor && neighbor < 40 * 40)
+				{
+					changedEdges.emplace_back(cell, neighbor);
+					changedEdges.emplace_back(neighbor, cell);
+				}
+			}
+		}
+		planner.update_edges(changedEdges);
+
+		const std::optional expected = dijkstra_distance(grid, begin, destination);
+		REQUIRE(planner.compute_distance() == expected);
+
+		const std::optional path = planner.find_path();
+		REQUIRE(path.has_value() == expected.has_value());
+		if (path)
+		{
+			REQUIRE(path_cost(grid, *path, begin, destination) == *expected);
+		}
+	}
+}
+
+TEST_CASE("lpa_star planner should expand fewer vertices when replanning.", "[lpa_star]")
+{
+	cost_grid grid{ 50, 50, std::vector<int>(50 * 50, 1) };
+	auto planner = make_planner(grid, 0, 50 * 50 - 1);
+	REQUIRE(planner.compute_distance() == 98);
+	const std::size_t initialExpansions{ planner.expansion_count() };
+
+	grid.costs[25 * 50 + 40] = 5;
+	planner.update_vertices(std::vector{ 25 * 50 + 40 });
+	REQUIRE(planner.compute_distance() == 98);
+	REQUIRE(planner.expansion_count() - initialExpansions < initialExpansions);
+}
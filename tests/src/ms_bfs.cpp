@@ -0,0 +1,175 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/breadth_first_search.hpp"
+#include "Simple-Graph/ms_bfs.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+TEST_CASE("ms_bfs mask_t should support the basic bit operations.", "[ms_bfs]")
+{
+	ms_bfs::mask256_t mask{};
+	REQUIRE(!mask.any());
+
+	mask.set(0).set(63).set(64).set(255);
+	REQUIRE(mask.any());
+	REQUIRE(mask.count() == 4);
+	REQUIRE(mask.test(63));
+	REQUIRE(!mask.test(62));
+
+	std::vector<std::size_t> bits{};
+	mask.for_each_bit([&](const std::size_t i) { bits.emplace_back(i); });
+	REQUIRE(bits == std::vector<std::size_t>{ 0, 63, 64, 255 });
+
+	REQUIRE((mask & ~mask) == ms_bfs::mask256_t{});
+	REQUIRE((mask | ~mask).count() == 256);
+}
+
+TEST_CASE("ms_bfs should correctly expose its typedefs.", "[ms_bfs]")
+{
+	const adjacency_graph graph{ make_random_graph(10, 2, 1, 42) };
+
+	const ms_bfs::search_params searcher
+	{
+		.sources = std::vector{ 0, 1 },
+		.vertexCount = 10,
+		.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+		.mask = ms_bfs::mask256_t{}
+	};
+	using searcher_t = decltype(searcher);
+
+	REQUIRE(std::same_as<searcher_t::vertex_t, int>);
+	REQUIRE(std::same_as<searcher_t::mask_t, ms_bfs::mask256_t>);
+	REQUIRE(std::same_as<searcher_t::node_t, ms_bfs::node_t<int, ms_bfs::mask256_t>>);
+	REQUIRE(std::same_as<searcher_t::sources_t, std::vector<int>>);
+	REQUIRE(std::same_as<searcher_t::callback_t, empty_invokable_t>);
+}
+
+TEST_CASE("ms_bfs should report the hop distances of a linear graph.", "[ms_bfs][traverse]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 6 };
+
+	std::vector<std::vector<int>> depths(2, std::vector<int>(end, -1));
+	traverse
+	(
+		ms_bfs::search_params
+		{
+			.sources = std::vector{ 1, 4 },
+			.vertexCount = end,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.callback = [&](const auto& node)
+			{
+				node.sources.for_each_bit
+				(
+					[&](const std::size_t i)
+					{
+						REQUIRE(depths[node.batchOffset + i][node.vertex] == -1);
+						depths[node.batchOffset + i][node.vertex] = node.depth;
+					}
+				);
+			}
+		}
+	);
+
+	REQUIRE(depths[0] == std::vector{ 1, 0, 1, 2, 3, 4 });
+	REQUIRE(depths[1] == std::vector{ 4, 3, 2, 1, 0, 1 });
+}
+
+TEST_CASE("ms_bfs should be interruptible by its callback.", "[ms_bfs][traverse]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 10 };
+
+	int lastVertex{ -1 };
+	traverse
+	(
+		ms_bfs::search_params
+		{
+			.sources = std::vector{ 0 },
+			.vertexCount = end,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.callback = [&](const auto& node)
+			{
+				lastVertex = node.vertex;
+				return node.depth == 3;
+			}
+		}
+	);
+
+	REQUIRE(lastVertex == 3);
+}
+
+template <class TMask>
+void check_against_bfs(const int vertexCount, const int sourceCount)
+{
+	const adjacency_graph graph{ make_random_graph(vertexCount, 3, 1, 1337) };
+
+	std::vector<int> sources{};
+	for (int i{ 0 }; i < sourceCount; ++i)
+	{
+		sources.emplace_back(i * 7 % vertexCount);
+	}
+
+	std::vector<std::vector<int>> depths(std::size(sources), std::vector<int>(vertexCount, -1));
+	traverse
+	(
+		ms_bfs::search_params
+		{
+			.sources = sources,
+			.vertexCount = static_cast<std::size_t>(vertexCount),
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.callback = [&](const auto& node)
+			{
+				node.sources.for_each_bit
+				(
+					[&](const std::size_t i)
+					{
+						REQUIRE(depths[node.batchOffset + i][node.vertex] == -1);
+						depths[node.batchOffset + i][node.vertex] = node.depth;
+					}
+				);
+			},
+			.mask = TMask{}
+		}
+	);
+
+	for (std::size_t i{ 0 }; i < std::size(sources); ++i)
+	{
+		std::vector<int> expected(vertexCount, -1);
+		traverse
+		(
+			bfs::search_params
+			{
+				.begin = sources[i],
+				.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+				.callback = [&](const auto& node) { expected[node.vertex] = node.weight_sum; },
+				.stateMap = std::map<int, bool>{}
+			}
+		);
+
+		REQUIRE(depths[i] == expected);
+	}
+}
+
+TEST_CASE("ms_bfs should report the same hop distances as the single source bfs.", "[ms_bfs][traverse]")
+{
+	const int sourceCount = GENERATE(1, 64, 100, 300);
+
+	SECTION("with 64 bit masks")
+	{
+		check_against_bfs<ms_bfs::mask64_t>(400, sourceCount);
+	}
+
+	SECTION("with 256 bit masks")
+	{
+		check_against_bfs<ms_bfs::mask256_t>(400, sourceCount);
+	}
+}
@@ -0,0 +1,172 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_vector.hpp>
+
+#include "Simple-Graph/multi_source.hpp"
+
+#include "helper.hpp"
+
+using namespace sl::graph;
+
+TEST_CASE("multi_source dijkstra should correctly expose its typedefs.", "[multi_source][dijkstra]")
+{
+	constexpr grid2d<int, 3, 4> grid{};
+	using sources_t = std::vector<multi_source::source_t<vertex, int>>;
+
+	const multi_source::dijkstra_search_params searcher
+	{
+		.sources = sources_t{ { { 0, 1 }, 0 } },
+		.neighborSearcher = grid_4way_neighbor_searcher{ &grid },
+		.weightCalculator = grid_weight_extractor{ &grid },
+		.stateMap = std::map<vertex, dijkstra::state_t<int>, vertex_less>{}
+	};
+	using searcher_t = decltype(searcher);
+
+	REQUIRE(std::same_as<searcher_t::vertex_t, vertex>);
+	REQUIRE(std::same_as<searcher_t::weight_t, int>);
+	REQUIRE(std::same_as<searcher_t::node_t, multi_source::node_t<weighted_node<vertex, int>>>);
+	REQUIRE(std::same_as<searcher_t::sources_t, sources_t>);
+}
+
+TEST_CASE("multi_source dijkstra should report the nearest source as origin of each node.", "[multi_source][dijkstra]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 10 };
+
+	// source 2 has an initial penalty, thus 4 is closer to source 7
+	const std::map<int, std::tuple<int, int>> expected
+	{
+		{ 0, { 2, 3 } },
+		{ 1, { 2, 2 } },
+		{ 2, { 2, 1 } },
+		{ 3, { 2, 2 } },
+		{ 4, { 7, 3 } },
+		{ 5, { 7, 2 } },
+		{ 6, { 7, 1 } },
+		{ 7, { 7, 0 } },
+		{ 8, { 7, 1 } },
+		{ 9, { 7, 2 } }
+	};
+
+	std::map<int, std::tuple<int, int>> visited{};
+	traverse
+	(
+		multi_source::dijkstra_search_params
+		{
+			.sources = std::vector<multi_source::source_t<int, int>>{ { 2, 1 }, { 7, 0 } },
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.callback = [&](const auto& node)
+			{
+				REQUIRE(visited.emplace(node.vertex, std::tuple{ node.origin, node.weight_sum }).second);
+			}
+		}
+	);
+
+	REQUIRE(visited == expected);
+}
+
+TEST_CASE("multi_source dijkstra should use the least initial weight of duplicated sources.", "[multi_source][dijkstra]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 3 };
+
+	std::map<int, int> weights{};
+	traverse
+	(
+		multi_source::dijkstra_search_params
+		{
+			.sources = std::vector<multi_source::source_t<int, int>>{ { 0, 5 }, { 0, 2 }, { 0, 4 } },
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = constant_t<1>{},
+			.callback = [&](const auto& node) { weights[node.vertex] = node.weight_sum; }
+		}
+	);
+
+	REQUIRE(weights == std::map<int, int>{ { 0, 2 }, { 1, 3 }, { 2, 4 } });
+}
+
+TEST_CASE("multi_source dijkstra find_path should return the path to the nearest source.", "[multi_source][dijkstra][find_path]")
+{
+	constexpr grid2d<int, 3, 4> grid
+	{
+		{
+			{ 1, 2, 1 },
+			{ 1, 1, 1 },
+			{ 1, 4, 1 },
+			{ 1, 2, 1 }
+		}
+	};
+
+	const auto path = find_path
+	(
+		multi_source::dijkstra_search_params
+		{
+			.sources = std::vector<multi_source::source_t<vertex, int>>{ { { 0, 0 }, 0 }, { { 2, 3 }, 0 } },
+			.neighborSearcher = grid_4way_neighbor_searcher{ .grid = &grid },
+			.weightCalculator = grid_weight_extractor{ .grid = &grid },
+			.callback = vertex_destination_t{ vertex{ 2, 1 } },
+			.stateMap = std::map<vertex, dijkstra::state_t<int>, vertex_less>{}
+		},
+		std::map<vertex, std::optional<vertex>, vertex_less>{}
+	);
+
+	REQUIRE(path == std::vector<vertex>{ { 2, 1 }, { 2, 2 }, { 2, 3 } });
+}
+
+TEST_CASE("multi_source bfs should report the nearest source as origin of each node.", "[multi_source][bfs]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 7 };
+
+	const std::map<int, std::tuple<int, int>> expected
+	{
+		{ 0, { 0, 0 } },
+		{ 1, { 0, 1 } },
+		{ 2, { 0, 2 } },
+		{ 3, { 5, 2 } },
+		{ 4, { 5, 1 } },
+		{ 5, { 5, 0 } },
+		{ 6, { 5, 1 } }
+	};
+
+	std::map<int, std::tuple<int, int>> visited{};
+	traverse
+	(
+		multi_source::bfs_search_params
+		{
+			.sources = std::vector{ 0, 5 },
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.callback = [&](const auto& node)
+			{
+				REQUIRE(visited.emplace(node.vertex, std::tuple{ node.origin, node.weight_sum }).second);
+			}
+		}
+	);
+
+	REQUIRE(visited == expected);
+}
+
+TEST_CASE("multi_source bfs find_path should return the path to the nearest source.", "[multi_source][bfs][find_path]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 10 };
+
+	const auto path = find_path
+	(
+		multi_source::bfs_search_params
+		{
+			.sources = std::vector{ 1, 8 },
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.callback = vertex_destination_t{ 5 }
+		},
+		std::map<int, std::optional<int>>{}
+	);
+
+	REQUIRE(path == std::vector{ 5, 6, 7, 8 });
+}
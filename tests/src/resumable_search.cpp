@@ -0,0 +1,141 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/resumable_search.hpp"
+
+#include "helper.hpp"
+
+#include <cstdlib>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+using namespace sl::graph;
+
+TEST_CASE("resumable search should visit the nodes in the same order as traverse.", "[resumable]")
+{
+	const unsigned seed = GENERATE(1u, 2u, 3u);
+	const std::size_t expansionsPerStep = GENERATE(1u, 3u, 1000u);
+	const adjacency_graph graph{ make_random_graph(60, 3, 9, seed) };
+
+	std::vector<std::tuple<int, int>> expected{};
+	traverse
+	(
+		dijkstra::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.callback = [&](const auto& node) { expected.emplace_back(node.vertex, node.weight_sum); }
+		}
+	);
+
+	std::vector<std::tuple<int, int>> actual{};
+	auto search = make_resumable_search
+	(
+		dijkstra::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.callback = [&](const auto& node) { actual.emplace_back(node.vertex, node.weight_sum); }
+		}
+	);
+
+	REQUIRE(search.status() == resumable::search_status::running);
+
+	std::size_t steps{ 0 };
+	while (search.step(expansionsPerStep) == resumable::search_status::running)
+	{
+		REQUIRE(std::size(actual) == (steps + 1) * expansionsPerStep);
+		++steps;
+	}
+
+	REQUIRE(search.status() == resumable::search_status::exhausted);
+	REQUIRE(actual == expected);
+}
+
+TEST_CASE("resumable search should not visit any node, if no expansions are granted.", "[resumable]")
+{
+	const adjacency_graph graph{ make_random_graph(10, 3, 9, 42) };
+
+	int invocations{ 0 };
+	auto search = make_resumable_search
+	(
+		dijkstra::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.callback = [&](const auto&) { ++invocations; }
+		}
+	);
+
+	REQUIRE(search.step(0) == resumable::search_status::running);
+	REQUIRE(invocations == 0);
+}
+
+TEST_CASE("resumable astar search should find the same path as find_path, when spread over several steps.", "[resumable][astar]")
+{
+	constexpr grid2d<int, 3, 4> grid
+	{
+		{
+			{ 1, 2, 1 },
+			{ 1, 1, 1 },
+			{ 1, 4, 1 },
+			{ 1, 2, 1 }
+		}
+	};
+
+	const auto [destination, expectedPath] = GENERATE
+	(
+		table<vertex,
+		std::optional<std::vector<vertex>>>({
+			{ { 2, 3 }, { { { 2, 3 }, { 2, 2 }, { 2, 1 }, { 1, 1 } } } },
+			{ { 3, 3 }, std::nullopt } // out of grid bounds
+			})
+	);
+
+	auto search = make_resumable_search
+	(
+		astar::search_params
+		{
+			.begin = vertex{ 1, 1 },
+			.neighborSearcher = grid_4way_neighbor_searcher{ .grid = &grid },
+			.weightCalculator = grid_weight_extractor{ .grid = &grid },
+			.heuristic = [destination](const vertex& v)
+			{
+				const auto diff{ destination - v };
+				return std::abs(diff.x()) + std::abs(diff.y());
+			},
+			.callback = vertex_destination_t{ destination },
+			.stateMap = std::map<vertex, astar::state_t<int>, vertex_less>{}
+		},
+		std::map<vertex, std::optional<vertex>, vertex_less>{}
+	);
+
+	REQUIRE(!search.path());
+
+	resumable::search_status status{ resumable::search_status::running };
+	int steps{ 0 };
+	for (; status == resumable::search_status::running; ++steps)
+	{
+		status = search.step(1);
+	}
+
+	REQUIRE(1 < steps);
+	REQUIRE(status == (expectedPath ? resumable::search_status::found : resumable::search_status::exhausted));
+	REQUIRE(search.step(1) == status);
+	REQUIRE(search.path() == expectedPath);
+	if (expectedPath)
+	{
+		REQUIRE(search.result().vertex == destination);
+		REQUIRE(search.result().weight_sum == 3);
+	}
+}
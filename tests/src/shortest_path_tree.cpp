@@ -0,0 +1,241 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/dijkstra.hpp"
+#include "Simple-Graph/shortest_path_tree.hpp"
+
+#include "helper.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <ranges>
+
+using namespace sl::graph;
+
+namespace
+{
+	using tree_t = sssp::tree_t<int, int>;
+
+	void check_tree_consistency(const tree_t& tree, const adjacency_graph& graph, int begin)
+	{
+		REQUIRE(tree.parents[begin] == begin);
+		REQUIRE(tree.distances[begin] == 0);
+		REQUIRE(tree.settleOrder.front() == begin);
+		REQUIRE(std::ranges::is_sorted(tree.settleOrder, std::ranges::less{}, [&](const int v) { return tree.distances[v]; }));
+		REQUIRE(std::ranges::count_if(tree.parents, [](const int parent) { return parent != tree_t::no_parent; }) == std::ssize(tree.settleOrder));
+
+		std::vector<bool> settled(std::size(tree.distances));
+		for (const int v : tree.settleOrder)
+		{
+			if (v != begin)
+			{
+				const int parent{ tree.parents[v] };
+				REQUIRE(settled[parent]);
+				REQUIRE(tree.distances[v] == tree.distances[parent] + adjacency_graph_weight_extractor{ &graph }(parent, v));
+			}
+			settled[v] = true;
+		}
+	}
+
+	// counts the edge lookups of csr_weight_calculator, which the dedicated csr_graph relaxation must never invoke
+	template <class TWeight>
+	struct edge_weight_counting_graph
+		: public csr_graph<int, TWeight>
+	{
+		mutable int edgeWeightCalls{};
+
+		[[nodiscard]]
+		std::optional<TWeight> edge_weight(const int& from, const int& to) const noexcept
+		{
+			++edgeWeightCalls;
+			return csr_graph<int, TWeight>::edge_weight(from, to);
+		}
+	};
+
+	template <class TWeight>
+	void check_high_degree_relaxation(unsigned seed)
+	{
+		constexpr int vertexCount{ 300 };
+
+		// each vertex has many edges, including duplicated targets with different weights, thus the blocks of the edge relaxation
+		// contain competing candidates for the same target
+		std::mt19937 rng{ seed };
+		std::uniform_int_distribution<int> vertexDist{ 0, vertexCount - 1 };
+		std::uniform_int_distribution<int> weightDist{ 0, 50 };
+		edge_weight_counting_graph<TWeight> graph{};
+		for (int v{ 0 }; v < vertexCount; ++v)
+		{
+			const int degree{ v % 7 == 0 ? 60 : 5 };
+			for (int i{ 0 }; i < degree; ++i)
+			{
+				graph.targets.emplace_back(i % 4 == 3 ? graph.targets.back() : vertexDist(rng));
+				graph.weights.emplace_back(static_cast<TWeight>(weightDist(rng)));
+			}
+			graph.offsets.emplace_back(std::size(graph.targets));
+		}
+
+		const auto csrTree = shortest_path_tree
+		(
+			sssp::search_params
+			{
+				.begin = 0,
+				.vertexCount = graph.vertex_count(),
+				.neighborSearcher = csr_neighbor_searcher{ &graph },
+				.weightCalculator = csr_weight_calculator{ &graph }
+			}
+		);
+		REQUIRE(graph.edgeWeightCalls == 0);
+
+		// the lambdas circumvent the dedicated csr_graph relaxation
+		const auto genericTree = shortest_path_tree
+		(
+			sssp::search_params
+			{
+				.begin = 0,
+				.vertexCount = graph.vertex_count(),
+				.neighborSearcher = [&](const int v) { return graph.neighbors(v); },
+				.weightCalculator = [&](const int from, const int to) { return *graph.edge_weight(from, to); }
+			}
+		);
+
+		REQUIRE(0 < graph.edgeWeightCalls);
+		REQUIRE(csrTree.distances == genericTree.distances);
+		for (const int v : csrTree.settleOrder | std::views::drop(1))
+		{
+			REQUIRE(csrTree.distances[v] == csrTree.distances[csrTree.parents[v]] + *graph.edge_weight(csrTree.parents[v], v));
+		}
+	}
+}
+
+TEST_CASE("sssp should correctly expose its typedefs.", "[sssp]")
+{
+	const adjacency_graph graph{};
+
+	const sssp::search_params params
+	{
+		.begin = 0,
+		.vertexCount = 0,
+		.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+		.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+	};
+	using params_t = decltype(params);
+
+	REQUIRE(std::same_as<params_t::vertex_t, int>);
+	REQUIRE(std::same_as<params_t::weight_t, int>);
+	REQUIRE(std::same_as<params_t::neighbor_searcher_t, adjacency_graph_neighbor_searcher>);
+	REQUIRE(std::same_as<params_t::weight_calculator_t, adjacency_graph_weight_extractor>);
+	REQUIRE(std::same_as<params_t::tree_t, sssp::tree_t<int, int>>);
+}
+
+TEST_CASE("shortest_path_tree should compute the tree of a linear graph.", "[sssp]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 6 };
+
+	const auto tree = shortest_path_tree
+	(
+		sssp::search_params
+		{
+			.begin = 2,
+			.vertexCount = end,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.weightCalculator = [](int, int current) { return current; }
+		}
+	);
+
+	REQUIRE(tree.distances == std::vector{ 1, 1, 0, 3, 7, 12 });
+	REQUIRE(tree.parents == std::vector{ 1, 2, 2, 2, 3, 4 });
+	REQUIRE(tree.settleOrder == std::vector{ 2, 1, 0, 3, 4, 5 });
+}
+
+TEST_CASE("shortest_path_tree should mark unreachable vertices.", "[sssp]")
+{
+	const adjacency_graph graph{ { { { 1, 4 } }, {}, { { 0, 1 } } } };
+
+	const auto tree = shortest_path_tree
+	(
+		sssp::search_params
+		{
+			.begin = 0,
+			.vertexCount = 3,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+		}
+	);
+
+	REQUIRE(tree.distances == std::vector{ 0, 4, tree_t::unreachable });
+	REQUIRE(tree.parents == std::vector{ 0, 0, tree_t::no_parent });
+	REQUIRE(tree.settleOrder == std::vector{ 0, 1 });
+	REQUIRE(tree.reachable(1));
+	REQUIRE(!tree.reachable(2));
+}
+
+TEST_CASE("shortest_path_tree should yield the same distances as a complete dijkstra traversal.", "[sssp]")
+{
+	const unsigned seed = GENERATE(1u, 2u, 3u, 4u);
+	const bool useCsrGraph = GENERATE(false, true);
+	const adjacency_graph graph{ make_random_graph(200, 3, 9, seed) };
+	const auto csrGraph = make_csr_graph<int>
+	(
+		std::size(graph.edges),
+		adjacency_graph_neighbor_searcher{ &graph },
+		adjacency_graph_weight_extractor{ &graph }
+	);
+
+	tree_t tree{};
+	for (const int begin : { 0, 17, 123 })
+	{
+		if (useCsrGraph)
+		{
+			shortest_path_tree
+			(
+				sssp::search_params
+				{
+					.begin = begin,
+					.vertexCount = csrGraph.vertex_count(),
+					.neighborSearcher = csr_neighbor_searcher{ &csrGraph },
+					.weightCalculator = csr_weight_calculator{ &csrGraph }
+				},
+				tree
+			);
+		}
+		else
+		{
+			shortest_path_tree
+			(
+				sssp::search_params
+				{
+					.begin = begin,
+					.vertexCount = std::size(graph.edges),
+					.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+					.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+				},
+				tree
+			);
+		}
+
+		std::vector<int> expectedDistances{};
+		std::ranges::transform
+		(
+			dijkstra_distances(graph, begin),
+			std::back_inserter(expectedDistances),
+			[](const std::optional<int>& distance) { return distance.value_or(tree_t::unreachable); }
+		);
+		REQUIRE(tree.distances == expectedDistances);
+		check_tree_consistency(tree, graph, begin);
+	}
+}
+
+TEST_CASE("shortest_path_tree should relax the edges of high degree csr_graph vertices correctly.", "[sssp]")
+{
+	const unsigned seed = GENERATE(1u, 2u, 3u);
+
+	check_high_degree_relaxation<int>(seed);
+	check_high_degree_relaxation<float>(seed);
+}
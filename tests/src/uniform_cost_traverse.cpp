@@ -13,6 +13,11 @@
 
 #include "helper.hpp"
 
+#include <algorithm>
+#include <ranges>
+#include <span>
+#include <stop_token>
+
 using namespace sl::graph;
 
 TEST_CASE("uniform_cost_traverse should visit all vertices of a given linear graph (order doesn't matter).", "[traverse]")
@@ -267,6 +272,102 @@ TEST_CASE("Test bfs traverse compiling with as much default params as possible."
 	);
 }
 
+TEST_CASE("bfs should stop at the next check, after a stop has been requested.", "[bfs][traverse]")
+{
+	constexpr int begin{ 0 };
+	constexpr int end{ 100 };
+
+	const auto [stopCheckInterval, expectedVisits] = GENERATE
+	(
+		table<std::size_t, int>({
+			{ 1, 5 },
+			{ 4, 7 },
+			{ 5, 9 }
+			})
+	);
+
+	std::stop_source stopSource{};
+	int visits{ 0 };
+	traverse
+	(
+		bfs::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = linear_graph_neighbor_searcher{ .begin = &begin, .end = &end },
+			.callback = [&](const auto&)
+			{
+				if (++visits == 5)
+					stopSource.request_stop();
+			},
+			.stopToken = stopSource.get_token(),
+			.stopCheckInterval = stopCheckInterval
+		}
+	);
+
+	REQUIRE(visits == expectedVisits);
+}
+
+TEST_CASE("bfs find_path with workspace should reuse the workspace for consecutive searches.", "[bfs][find_path]")
+{
+	constexpr grid2d<int, 3, 4> grid{};
+
+	auto workspace = bfs::workspace_t<vertex, state_map_2d, bfs::default_open_list_t<vertex>, std::map<vertex, std::optional<vertex>, vertex_less>>{};
+
+	const auto [destination, expectedLength] = GENERATE
+	(
+		table<vertex, std::size_t>({
+			{ { 2, 3 }, 6 },
+			{ { 0, 0 }, 1 },
+			{ { 1, 2 }, 4 }
+			})
+	);
+
+	for (int i{ 0 }; i < 2; ++i)
+	{
+		const std::optional path = find_path
+		(
+			bfs::search_params
+			{
+				.begin = vertex{ 0, 0 },
+				.neighborSearcher = grid_4way_neighbor_searcher{ &grid },
+				.callback = vertex_destination_t{ destination },
+				.stateMap = state_map_2d{}
+			},
+			workspace
+		);
+
+		REQUIRE(path);
+		REQUIRE(std::size(*path) == expectedLength);
+		REQUIRE(path->front() == destination);
+		REQUIRE(path->back() == vertex{ 0, 0 });
+	}
+}
+
+TEST_CASE("bfs find_path with buffer should write the path in the requested order.", "[bfs][find_path]")
+{
+	constexpr grid2d<int, 3, 4> grid{};
+
+	const bfs::search_params params
+	{
+		.begin = vertex{ 0, 0 },
+		.neighborSearcher = grid_4way_neighbor_searcher{ &grid },
+		.callback = vertex_destination_t{ vertex{ 2, 3 } },
+		.stateMap = state_map_2d{}
+	};
+	auto workspace = make_workspace(params, std::map<vertex, std::optional<vertex>, vertex_less>{});
+
+	std::vector<vertex> buffer(12);
+	const std::optional reversedLength = find_path(params, workspace, buffer);
+	REQUIRE(reversedLength == 6);
+	const std::vector reversedPath(std::begin(buffer), std::begin(buffer) + *reversedLength);
+
+	const std::optional forwardLength = find_path(params, workspace, buffer, path_order::forward);
+	REQUIRE(forwardLength == 6);
+	REQUIRE(std::ranges::equal(std::span{ buffer }.first(*forwardLength), reversedPath | std::views::reverse));
+	REQUIRE(buffer.front() == vertex{ 0, 0 });
+	REQUIRE(buffer[5] == vertex{ 2, 3 });
+}
+
 TEST_CASE("bfs should visit all vertices in a specific order.", "[bfs][traverse]")
 {
 	constexpr grid2d<int, 3, 4> grid{};
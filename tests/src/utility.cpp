@@ -7,8 +7,16 @@
 #include <catch2/generators/catch_generators.hpp>
 
 #include "Simple-Graph/path_finder.hpp"
+#include "Simple-Graph/queue_helper.hpp"
+#include "Simple-Graph/stack_helper.hpp"
 #include "Simple-Graph/utility.hpp"
 
+#include <map>
+#include <optional>
+#include <queue>
+#include <stack>
+#include <vector>
+
 using namespace sl::graph;
 
 namespace
@@ -89,3 +97,30 @@ TEST_CASE("path_finder_t should invoke destinationPredicate.", "[utility]")
 	std::invoke(make_path_finder<node_t<int>>(predicate, std::back_inserter(dummy)), node_t<int>{ .vertex = 42 });
 	REQUIRE(invoke_counter == 1);
 }
+
+TEST_CASE("clear should value-initialize the elements of random access ranges, but keep their size.", "[utility]")
+{
+	std::vector<std::optional<int>> container{ 1, std::nullopt, 3 };
+
+	clear(container);
+
+	REQUIRE(container == std::vector<std::optional<int>>(3));
+}
+
+TEST_CASE("clear should remove all elements of other containers.", "[utility]")
+{
+	std::map<int, int> map{ { 1, 2 }, { 3, 4 } };
+	std::priority_queue<int> priorityQueue{ std::less<int>{}, std::vector{ 1, 2, 3 } };
+	std::queue<int> queue{ std::deque{ 1, 2 } };
+	std::stack<int> stack{ std::deque{ 1, 2 } };
+
+	clear(map);
+	clear(priorityQueue);
+	clear(queue);
+	clear(stack);
+
+	REQUIRE(std::empty(map));
+	REQUIRE(std::empty(priorityQueue));
+	REQUIRE(std::empty(queue));
+	REQUIRE(std::empty(stack));
+}
@@ -0,0 +1,196 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/views.hpp"
+
+#include "helper.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+using namespace sl::graph;
+
+namespace
+{
+	struct counting_neighbor_searcher
+	{
+		const adjacency_graph* graph{};
+		int* invocations{};
+
+		auto operator ()(const int& v) const
+		{
+			++*invocations;
+			return graph->edges[v] | std::views::keys;
+		}
+	};
+}
+
+TEST_CASE("views::bfs and views::dfs should yield the nodes in the same order as traverse.", "[views][bfs][dfs]")
+{
+	constexpr grid2d<int, 3, 4> grid{};
+
+	std::vector<std::tuple<vertex, int>> expected{};
+	std::vector<std::tuple<vertex, int>> actual{};
+
+	SECTION("bfs")
+	{
+		const bfs::search_params params
+		{
+			.begin = vertex{ 0, 1 },
+			.neighborSearcher = grid_4way_neighbor_searcher{ &grid },
+			.callback = [&](const auto& node) { expected.emplace_back(node.vertex, node.weight_sum); },
+			.stateMap = state_map_2d{}
+		};
+		traverse(params);
+
+		for (const auto& node : views::bfs(params))
+		{
+			actual.emplace_back(node.vertex, node.weight_sum);
+		}
+	}
+
+	SECTION("dfs")
+	{
+		const dfs::search_params params
+		{
+			.begin = vertex{ 0, 1 },
+			.neighborSearcher = grid_4way_neighbor_searcher{ &grid },
+			.callback = [&](const auto& node) { expected.emplace_back(node.vertex, node.weight_sum); },
+			.stateMap = state_map_2d{}
+		};
+		traverse(params);
+
+		for (const auto& node : views::dfs(params))
+		{
+			actual.emplace_back(node.vertex, node.weight_sum);
+		}
+	}
+
+	REQUIRE(std::size(expected) == 3 * 4);
+	REQUIRE(actual == expected);
+}
+
+TEST_CASE("views::dijkstra and views::astar should yield the nodes in the same order as traverse.", "[views][dijkstra][astar]")
+{
+	const unsigned seed = GENERATE(1u, 2u, 3u);
+	const adjacency_graph graph{ make_random_graph(60, 3, 9, seed) };
+
+	std::vector<std::tuple<int, int>> expected{};
+	std::vector<std::tuple<int, int>> actual{};
+
+	SECTION("dijkstra")
+	{
+		const dijkstra::search_params params
+		{
+			.begin = 0,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.callback = [&](const auto& node) { expected.emplace_back(node.vertex, node.weight_sum); }
+		};
+		traverse(params);
+
+		for (const auto& node : views::dijkstra(params))
+		{
+			actual.emplace_back(node.vertex, node.weight_sum);
+		}
+
+		REQUIRE(std::ranges::is_sorted(actual, std::ranges::less{}, [](const auto& tuple) { return std::get<1>(tuple); }));
+	}
+
+	SECTION("astar")
+	{
+		const astar::search_params params
+		{
+			.begin = 0,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.heuristic = [](const int v) { return v % 2; },
+			.callback = [&](const auto& node) { expected.emplace_back(node.vertex, node.weight_sum); }
+		};
+		traverse(params);
+
+		for (const auto& node : views::astar(params))
+		{
+			actual.emplace_back(node.vertex, node.weight_sum);
+		}
+	}
+
+	REQUIRE(!std::empty(expected));
+	REQUIRE(actual == expected);
+}
+
+TEST_CASE("traversal views should not expand nodes, before the iterator advances past them.", "[views]")
+{
+	const adjacency_graph graph{ make_random_graph(60, 3, 9, 42) };
+	const int visitCount = GENERATE(1, 2, 10);
+
+	int invocations{ 0 };
+	int visited{ 0 };
+	for (const auto& node : views::dijkstra
+		(
+			dijkstra::search_params
+			{
+				.begin = 0,
+				.neighborSearcher = counting_neighbor_searcher{ &graph, &invocations },
+				.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+			}
+		))
+	{
+		// the begin is yielded first, without any expansion
+		if (visited == 0)
+		{
+			REQUIRE(node.vertex == 0);
+		}
+		if (++visited == visitCount)
+			break;
+	}
+
+	REQUIRE(visited == visitCount);
+	REQUIRE(invocations == visitCount - 1);
+}
+
+TEST_CASE("traversal views should be composable with the standard range adaptors and algorithms.", "[views]")
+{
+	const adjacency_graph graph{ make_random_graph(60, 3, 9, 42) };
+	const dijkstra::search_params params
+	{
+		.begin = 0,
+		.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+		.weightCalculator = adjacency_graph_weight_extractor{ &graph }
+	};
+
+	STATIC_REQUIRE(std::ranges::view<decltype(views::dijkstra(params))>);
+	STATIC_REQUIRE(std::ranges::input_range<decltype(views::dijkstra(params))>);
+
+	std::vector<int> firstVertices{};
+	std::ranges::copy(views::dijkstra(params) | std::views::take(5) | std::views::transform(&dijkstra::node_t<int, int>::vertex), std::back_inserter(firstVertices));
+
+	std::vector<int> expectedVertices{};
+	traverse
+	(
+		dijkstra::search_params
+		{
+			.begin = 0,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.callback = [&](const auto& node)
+			{
+				expectedVertices.emplace_back(node.vertex);
+				return std::size(expectedVertices) == 5;
+			}
+		}
+	);
+	REQUIRE(firstVertices == expectedVertices);
+
+	auto view = views::dijkstra(params);
+	const auto itr = std::ranges::find_if(view, [&](const auto& node) { return node.vertex == expectedVertices.back(); });
+	REQUIRE(itr != std::ranges::end(view));
+	REQUIRE((*itr).vertex == expectedVertices.back());
+}
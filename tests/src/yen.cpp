@@ -0,0 +1,242 @@
+//           Copyright Dominic Koepke 2022 - 2022.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "Simple-Graph/yen.hpp"
+
+#include "helper.hpp"
+
+#include <unordered_map>
+
+using namespace sl::graph;
+
+namespace
+{
+	// enumerates the costs of all loopless paths via depth first search
+	void collect_path_costs(const adjacency_graph& graph, int current, int destination, int cost, std::vector<bool>& onPath, std::vector<int>& costs)
+	{
+		if (current == destination)
+		{
+			costs.emplace_back(cost);
+			return;
+		}
+
+		onPath[current] = true;
+		for (const auto& [next, weight] : graph.edges[current])
+		{
+			if (!onPath[next])
+				collect_path_costs(graph, next, destination, cost + weight, onPath, costs);
+		}
+		onPath[current] = false;
+	}
+
+	std::vector<int> all_path_costs(const adjacency_graph& graph, int begin, int destination)
+	{
+		std::vector<bool> onPath(std::size(graph.edges), false);
+		std::vector<int> costs{};
+		collect_path_costs(graph, begin, destination, 0, onPath, costs);
+		std::ranges::sort(costs);
+		return costs;
+	}
+}
+
+TEST_CASE("yen find_paths should find the k shortest loopless paths in ascending order.", "[yen][find_path]")
+{
+	const adjacency_graph graph
+	{
+		{
+			{ { 1, 1 }, { 2, 3 }, { 3, 10 } },
+			{ { 3, 4 }, { 2, 1 } },
+			{ { 3, 1 } },
+			{}
+		}
+	};
+
+	const std::size_t pathCount = GENERATE(1u, 3u, 4u, 10u);
+	const auto paths = find_paths
+	(
+		yen::search_params
+		{
+			.begin = 0,
+			.destination = 3,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.pathCount = pathCount
+		}
+	);
+
+	const std::vector<yen::path_t<int, int>> expected
+	{
+		{ { 3, 2, 1, 0 }, 3 },
+		{ { 3, 2, 0 }, 4 },
+		{ { 3, 1, 0 }, 5 },
+		{ { 3, 0 }, 10 }
+	};
+
+	REQUIRE(std::ranges::equal(paths, expected | std::views::take(pathCount)));
+}
+
+TEST_CASE("yen find_paths should yield the trivial path, if begin equals destination.", "[yen][find_path]")
+{
+	const adjacency_graph graph{ { { { 1, 1 } }, { { 0, 1 } } } };
+
+	const auto paths = find_paths
+	(
+		yen::search_params
+		{
+			.begin = 0,
+			.destination = 0,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.pathCount = 5
+		}
+	);
+
+	REQUIRE(paths == std::vector{ yen::path_t<int, int>{ { 0 }, 0 } });
+}
+
+TEST_CASE("yen find_paths should yield nothing, if destination is unreachable.", "[yen][find_path]")
+{
+	const adjacency_graph graph{ { { { 1, 1 } }, {}, {} } };
+
+	const auto paths = find_paths
+	(
+		yen::search_params
+		{
+			.begin = 0,
+			.destination = 2,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.pathCount = 5
+		}
+	);
+
+	REQUIRE(std::empty(paths));
+}
+
+TEST_CASE("yen find_paths should agree with the enumeration of all loopless paths.", "[yen][find_path]")
+{
+	const unsigned seed = GENERATE(1u, 42u, 1337u, 4711u);
+	const adjacency_graph graph{ make_random_graph(12, 3, 9, seed) };
+	constexpr std::size_t pathCount{ 15 };
+
+	const std::vector expectedCosts = all_path_costs(graph, 0, 11);
+
+	const auto paths = find_paths
+	(
+		yen::search_params
+		{
+			.begin = 0,
+			.destination = 11,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.pathCount = pathCount,
+			.stateMap = std::unordered_map<int, yen::state_t<int>>{},
+			.predecessorMap = std::unordered_map<int, std::optional<int>>{}
+		}
+	);
+
+	REQUIRE(std::size(paths) == std::min(pathCount, std::size(expectedCosts)));
+	for (std::size_t i{ 0 }; i < std::size(paths); ++i)
+	{
+		const auto& [vertices, weightSum] = paths[i];
+		REQUIRE(weightSum == expectedCosts[i]);
+		REQUIRE(vertices.front() == 11);
+		REQUIRE(vertices.back() == 0);
+
+		int cost{ 0 };
+		for (std::size_t j{ 1 }; j < std::size(vertices); ++j)
+		{
+			cost += adjacency_graph_weight_extractor{ &graph }(vertices[j], vertices[j - 1]);
+		}
+		REQUIRE(cost == weightSum);
+
+		std::vector sortedVertices{ vertices };
+		std::ranges::sort(sortedVertices);
+		REQUIRE(std::ranges::adjacent_find(sortedVertices) == std::end(sortedVertices));
+
+		for (std::size_t j{ 0 }; j < i; ++j)
+		{
+			REQUIRE(paths[j].vertices != vertices);
+		}
+	}
+}
+
+TEST_CASE("yen find_paths should support dense state and predecessor maps.", "[yen][find_path]")
+{
+	const adjacency_graph graph{ make_random_graph(12, 3, 9, 42) };
+	const std::vector expectedCosts = all_path_costs(graph, 0, 11);
+
+	const auto paths = find_paths
+	(
+		yen::search_params
+		{
+			.begin = 0,
+			.destination = 11,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.pathCount = 10,
+			.stateMap = std::vector<yen::state_t<int>>(12),
+			.predecessorMap = std::vector<std::optional<int>>(12)
+		}
+	);
+
+	REQUIRE(std::size(paths) == std::min<std::size_t>(10, std::size(expectedCosts)));
+	for (std::size_t i{ 0 }; i < std::size(paths); ++i)
+	{
+		REQUIRE(paths[i].weight_sum == expectedCosts[i]);
+	}
+}
+
+TEST_CASE("yen traverse should stop, if the callback returns true.", "[yen]")
+{
+	const adjacency_graph graph{ make_random_graph(12, 3, 9, 42) };
+
+	int invocations{ 0 };
+	traverse
+	(
+		yen::search_params
+		{
+			.begin = 0,
+			.destination = 11,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.pathCount = 100,
+			.callback = [&](const auto&) { return ++invocations == 2; }
+		}
+	);
+
+	REQUIRE(invocations == 2);
+}
+
+TEST_CASE("yen find_paths should respect the vertex predicate.", "[yen][find_path]")
+{
+	const adjacency_graph graph
+	{
+		{
+			{ { 1, 1 }, { 2, 3 }, { 3, 10 } },
+			{ { 3, 4 }, { 2, 1 } },
+			{ { 3, 1 } },
+			{}
+		}
+	};
+
+	const auto paths = find_paths
+	(
+		yen::search_params
+		{
+			.begin = 0,
+			.destination = 3,
+			.neighborSearcher = adjacency_graph_neighbor_searcher{ &graph },
+			.weightCalculator = adjacency_graph_weight_extractor{ &graph },
+			.pathCount = 10,
+			.vertexPredicate = [](const auto&, int v) { return v != 2; }
+		}
+	);
+
+	REQUIRE(paths == std::vector<yen::path_t<int, int>>{ { { 3, 1, 0 }, 5 }, { { 3, 0 }, 10 } });
+}